@@ -35,6 +35,9 @@ HEADERS  += \
     $$PWD/musiccoremplayer.h \
     $$PWD/musicsong.h \
     $$PWD/musicsongmeta.h \
+    $$PWD/musicsonglibrarymanager.h \
+    $$PWD/musicplayliststoremanager.h \
+    $$PWD/musicsongmetascanner.h \
     $$PWD/musiccryptographichash.h \
     $$PWD/musicbackgroundmanager.h \
     $$PWD/musicsemaphoreloop.h \
@@ -42,7 +45,9 @@ HEADERS  += \
     $$PWD/musicplaylistmanager.h \
     $$PWD/musichotkeymanager.h \
     $$PWD/musicruntimemanager.h \
+    $$PWD/musicstartupmanager.h \
     $$PWD/musicdispatchmanager.h \
+    $$PWD/musicdownloadcachemanager.h \
     $$PWD/musicextractwrapper.h \
     $$PWD/musicbackgroundconfigmanager.h \
     $$PWD/musicconfigmanager.h \
@@ -62,6 +67,9 @@ SOURCES += \
     $$PWD/musicsingleton.cpp \
     $$PWD/musicsong.cpp \
     $$PWD/musicsongmeta.cpp \
+    $$PWD/musicsonglibrarymanager.cpp \
+    $$PWD/musicplayliststoremanager.cpp \
+    $$PWD/musicsongmetascanner.cpp \
     $$PWD/musiccryptographichash.cpp \
     $$PWD/musicbackgroundmanager.cpp \
     $$PWD/musicsemaphoreloop.cpp \
@@ -69,7 +77,9 @@ SOURCES += \
     $$PWD/musicplaylistmanager.cpp \
     $$PWD/musichotkeymanager.cpp \
     $$PWD/musicruntimemanager.cpp \
+    $$PWD/musicstartupmanager.cpp \
     $$PWD/musicdispatchmanager.cpp \
+    $$PWD/musicdownloadcachemanager.cpp \
     $$PWD/musicextractwrapper.cpp \
     $$PWD/musicbackgroundconfigmanager.cpp \
     $$PWD/musicconfigmanager.cpp \
@@ -16,7 +16,8 @@ void MusicXmlNodeHelper::load()
     {
         if(!m_current.isNull() && m_current.isElement())
         {
-            m_nodeNames.insert(m_current.nodeName());
+            const QString &name = m_current.nodeName();
+            m_nodeNames.insert(name.toLower(), name);
         }
     } while(hasNext());
 }
@@ -67,14 +68,7 @@ QDomNode MusicXmlNodeHelper::next() const
 
 QString MusicXmlNodeHelper::nodeName(const QString &name) const
 {
-    for(const QString &value : qAsConst(m_nodeNames))
-    {
-        if(value.toLower() == name.toLower())
-        {
-            return value;
-        }
-    }
-    return name;
+    return m_nodeNames.value(name.toLower(), name);
 }
 
 
@@ -84,16 +78,20 @@ MusicAbstractXml::MusicAbstractXml(QObject *parent)
 {
     m_file = nullptr;
     m_document = nullptr;
+    m_reader = nullptr;
+    m_writer = nullptr;
 }
 
 MusicAbstractXml::~MusicAbstractXml()
 {
+    clearStream();
     delete m_file;
     delete m_document;
 }
 
 bool MusicAbstractXml::readConfig(const QString &name)
 {
+    clearStream();
     delete m_file;
     delete m_document;
     m_file = new QFile(name);
@@ -117,6 +115,7 @@ bool MusicAbstractXml::readConfig(const QString &name)
 
 bool MusicAbstractXml::writeConfig(const QString &name)
 {
+    clearStream();
     delete m_file;
     delete m_document;
     m_file = new QFile(name);
@@ -131,6 +130,7 @@ bool MusicAbstractXml::writeConfig(const QString &name)
 
 bool MusicAbstractXml::fromString(const QString &data)
 {
+    clearStream();
     delete m_file;
     delete m_document;
     m_file = nullptr;
@@ -146,6 +146,7 @@ bool MusicAbstractXml::fromString(const QString &data)
 
 bool MusicAbstractXml::fromByteArray(const QByteArray &data)
 {
+    clearStream();
     delete m_file;
     delete m_document;
     m_file = nullptr;
@@ -329,3 +330,117 @@ QDomElement MusicAbstractXml::writeDomText(QDomElement &element, const QString &
     domElement.appendChild(domText);
     return domElement;
 }
+
+bool MusicAbstractXml::readStreamConfig(const QString &name)
+{
+    clearStream();
+    delete m_file;
+    delete m_document;
+    m_document = nullptr;
+    m_file = new QFile(name);
+
+    if(!m_file->open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    m_reader = new QXmlStreamReader(m_file);
+    return true;
+}
+
+bool MusicAbstractXml::writeStreamConfig(const QString &name)
+{
+    clearStream();
+    delete m_file;
+    delete m_document;
+    m_document = nullptr;
+    m_file = new QFile(name);
+
+    if(!m_file->open(QFile::WriteOnly | QFile::Truncate))
+    {
+        return false;
+    }
+
+    m_writer = new QXmlStreamWriter(m_file);
+    m_writer->setAutoFormatting(true);
+    m_writer->setAutoFormattingIndent(4);
+    return true;
+}
+
+bool MusicAbstractXml::readStreamElement()
+{
+    if(!m_reader)
+    {
+        return false;
+    }
+
+    while(!m_reader->atEnd())
+    {
+        if(m_reader->readNext() == QXmlStreamReader::StartElement)
+        {
+            return true;
+        }
+    }
+
+    if(m_reader->hasError() && m_reader->error() != QXmlStreamReader::PrematureEndOfDocumentError)
+    {
+        TTK_LOGGER_ERROR("Xml stream read error: " << m_reader->errorString());
+    }
+    return false;
+}
+
+bool MusicAbstractXml::isStreamElement(const QString &name) const
+{
+    return m_reader && m_reader->isStartElement() && m_reader->name().compare(name, Qt::CaseInsensitive) == 0;
+}
+
+QString MusicAbstractXml::readStreamAttribute(const QString &name) const
+{
+    return m_reader ? m_reader->attributes().value(name).toString() : QString();
+}
+
+QString MusicAbstractXml::readStreamText()
+{
+    return m_reader ? m_reader->readElementText() : QString();
+}
+
+void MusicAbstractXml::writeStreamRoot(const QString &node, const MusicXmlAttributes &attrs)
+{
+    m_writer->writeStartDocument();
+    writeStreamElement(node, attrs);
+}
+
+void MusicAbstractXml::writeStreamElement(const QString &node, const MusicXmlAttributes &attrs)
+{
+    m_writer->writeStartElement(node);
+    for(const MusicXmlAttribute &attr : qAsConst(attrs))
+    {
+        m_writer->writeAttribute(attr.m_key, attr.m_value.toString());
+    }
+}
+
+void MusicAbstractXml::writeStreamElementText(const QString &node, const MusicXmlAttributes &attrs, const QString &text)
+{
+    writeStreamElement(node, attrs);
+    m_writer->writeCharacters(text);
+    m_writer->writeEndElement();
+}
+
+void MusicAbstractXml::writeStreamEndElement()
+{
+    m_writer->writeEndElement();
+}
+
+void MusicAbstractXml::writeStreamEnd()
+{
+    m_writer->writeEndDocument();
+    m_file->flush();
+}
+
+void MusicAbstractXml::clearStream()
+{
+    delete m_reader;
+    m_reader = nullptr;
+    delete m_writer;
+    m_writer = nullptr;
+}
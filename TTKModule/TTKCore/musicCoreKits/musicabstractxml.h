@@ -21,6 +21,8 @@
 
 #include <QFile>
 #include <QTextStream>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 #include <QtXml/QDomDocument>
 
 #include "musicsong.h"
@@ -72,7 +74,7 @@ public:
 
 private:
     QDomNode m_root, m_current;
-    QSet<QString> m_nodeNames;
+    QHash<QString, QString> m_nodeNames;
 
 };
 
@@ -178,9 +180,61 @@ public:
      */
     void writeAttribute(QDomElement &element, const MusicXmlAttribute &attr);
 
+    /*!
+     * Open xml file for single pass reading, no dom document is built.
+     */
+    bool readStreamConfig(const QString &name);
+    /*!
+     * Open xml file for single pass writing, no dom document is built.
+     */
+    bool writeStreamConfig(const QString &name);
+    /*!
+     * Read to the next start element, return false at the end of document.
+     */
+    bool readStreamElement();
+    /*!
+     * Check current start element name case insensitive.
+     */
+    bool isStreamElement(const QString &name) const;
+    /*!
+     * Read current start element attribute by name.
+     */
+    QString readStreamAttribute(const QString &name) const;
+    /*!
+     * Read current start element text, stream moves to its end element.
+     */
+    QString readStreamText();
+    /*!
+     * Write xml processing instruction and root element by node name.
+     */
+    void writeStreamRoot(const QString &node, const MusicXmlAttributes &attrs = MusicXmlAttributes());
+    /*!
+     * Write xml start element by node name and atrrs.
+     */
+    void writeStreamElement(const QString &node, const MusicXmlAttributes &attrs = MusicXmlAttributes());
+    /*!
+     * Write xml element by node name\ atrrs and attribute's text.
+     */
+    void writeStreamElementText(const QString &node, const MusicXmlAttributes &attrs, const QString &text);
+    /*!
+     * Close the last opened xml start element.
+     */
+    void writeStreamEndElement();
+    /*!
+     * Close all opened elements and finish the document.
+     */
+    void writeStreamEnd();
+
 protected:
+    /*!
+     * Release xml stream reader and writer.
+     */
+    void clearStream();
+
     QFile *m_file;
     QDomDocument *m_document;
+    QXmlStreamReader *m_reader;
+    QXmlStreamWriter *m_writer;
 
 };
 
@@ -0,0 +1,280 @@
+#include "musicdownloadcachemanager.h"
+#include "musicsettingmanager.h"
+
+#include <QDir>
+#include <QDateTime>
+#include <QDataStream>
+
+#define CACHE_VERSION           1
+#define CACHE_SAVE_INTERVAL     5 * MT_S2MS
+
+MusicDownloadCacheManager::MusicDownloadCacheManager()
+    : QObject(nullptr)
+{
+    m_loaded = false;
+    m_currentSize = 0;
+    m_lastTime = 0;
+
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(CACHE_SAVE_INTERVAL);
+    connect(&m_timer, SIGNAL(timeout()), SLOT(saveCache()));
+}
+
+bool MusicDownloadCacheManager::readCache(const QString &path)
+{
+    m_loaded = true;
+    m_items.clear();
+    m_order.clear();
+    m_currentSize = 0;
+
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_6);
+
+    int version = 0, count = 0;
+    stream >> version >> count;
+    if(version != CACHE_VERSION)
+    {
+        return false;
+    }
+
+    for(int i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
+    {
+        QString key;
+        MusicDownloadCacheItem item;
+        stream >> key >> item.m_size >> item.m_time;
+        if(cacheKey(key) != key)
+        {
+            ///indexes of the user download dirs are never evicted
+            changed();
+            continue;
+        }
+
+        m_items.insert(key, item);
+        m_order.insert(item.m_time, key);
+        m_currentSize += item.m_size;
+        m_lastTime = qMax(m_lastTime, item.m_time);
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+bool MusicDownloadCacheManager::writeCache(const QString &path)
+{
+    m_timer.stop();
+    if(!m_loaded)
+    {
+        return false;
+    }
+
+    QFile file(path);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_6);
+    stream << int(CACHE_VERSION) << m_order.count();
+
+    ///least recently used first
+    for(auto it = m_order.constBegin(); it != m_order.constEnd(); ++it)
+    {
+        const MusicDownloadCacheItem &item = m_items.value(it.value());
+        stream << it.value() << item.m_size << item.m_time;
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+void MusicDownloadCacheManager::insert(const QString &path)
+{
+    loadCache();
+
+    const QString &key = cacheKey(path);
+    if(key.isEmpty())
+    {
+        return;
+    }
+
+    const QFileInfo info(key);
+    if(!info.isFile())
+    {
+        take(key, false);
+        return;
+    }
+
+    append(key, info.size());
+    checkCacheSize();
+}
+
+void MusicDownloadCacheManager::touch(const QString &path)
+{
+    loadCache();
+
+    const QString &key = cacheKey(path);
+    if(key.isEmpty())
+    {
+        return;
+    }
+
+    auto it = m_items.find(key);
+    if(it != m_items.end())
+    {
+        append(key, it.value().m_size);
+        return;
+    }
+
+    ///files cached before the index existed are recorded on first access
+    const QFileInfo info(key);
+    if(info.isFile())
+    {
+        append(key, info.size());
+        checkCacheSize();
+    }
+}
+
+void MusicDownloadCacheManager::remove(const QString &path)
+{
+    loadCache();
+
+    const QString &key = cacheKey(path);
+    if(!key.isEmpty())
+    {
+        take(key, false);
+    }
+}
+
+void MusicDownloadCacheManager::removeByDir(const QString &dir)
+{
+    loadCache();
+
+    const QString &prefix = QDir::cleanPath(QDir(dir).absolutePath()) + "/";
+    QStringList keys;
+    for(auto it = m_items.constBegin(); it != m_items.constEnd(); ++it)
+    {
+        if(it.key().startsWith(prefix))
+        {
+            keys << it.key();
+        }
+    }
+
+    for(const QString &key : qAsConst(keys))
+    {
+        take(key, false);
+    }
+}
+
+qint64 MusicDownloadCacheManager::maximumCacheSize() const
+{
+    if(!G_SETTING_PTR->value(MusicSettingManager::DownloadCacheLimit).toInt())
+    {
+        return -1;
+    }
+    return qint64(G_SETTING_PTR->value(MusicSettingManager::DownloadCacheSize).toInt()) * MH_MB2B;
+}
+
+void MusicDownloadCacheManager::checkCacheSize()
+{
+    loadCache();
+
+    const qint64 size = maximumCacheSize();
+    if(size < 0)
+    {
+        return;
+    }
+
+    ///the most recently used file is kept even if it alone exceeds the limit
+    int count = 0;
+    while(m_currentSize > size && m_order.count() > 1)
+    {
+        const QString path = m_order.constBegin().value();
+        take(path, true);
+        ++count;
+    }
+
+    if(count > 0)
+    {
+        TTK_LOGGER_INFO(QString("%1 remove %2 files, cache size %3").arg(getClassName()).arg(count).arg(m_currentSize));
+    }
+}
+
+void MusicDownloadCacheManager::saveCache()
+{
+    writeCache();
+}
+
+void MusicDownloadCacheManager::loadCache()
+{
+    if(!m_loaded)
+    {
+        readCache();
+    }
+}
+
+QString MusicDownloadCacheManager::cacheKey(const QString &path) const
+{
+    if(path.isEmpty())
+    {
+        return QString();
+    }
+
+    ///only the cache dirs are managed, files in the download dirs belong to the user
+    const QString &key = QDir::cleanPath(QFileInfo(path).absoluteFilePath());
+    QStringList dirs;
+    dirs << CACHE_DIR_FULL << ART_DIR_FULL;
+
+    for(const QString &dir : qAsConst(dirs))
+    {
+        if(!dir.isEmpty() && key.startsWith(QDir::cleanPath(QDir(dir).absolutePath()) + "/"))
+        {
+            return key;
+        }
+    }
+    return QString();
+}
+
+void MusicDownloadCacheManager::append(const QString &path, qint64 size)
+{
+    take(path, false);
+
+    ///access times are kept unique so that the order is strict
+    MusicDownloadCacheItem item;
+    item.m_size = size;
+    item.m_time = m_lastTime = qMax(QDateTime::currentMSecsSinceEpoch(), m_lastTime + 1);
+
+    m_items.insert(path, item);
+    m_order.insert(item.m_time, path);
+    m_currentSize += size;
+    changed();
+}
+
+void MusicDownloadCacheManager::take(const QString &path, bool file)
+{
+    auto it = m_items.find(path);
+    if(it == m_items.end())
+    {
+        return;
+    }
+
+    m_currentSize -= it.value().m_size;
+    m_order.remove(it.value().m_time);
+    m_items.erase(it);
+    changed();
+
+    if(file)
+    {
+        QFile::remove(path);
+    }
+}
+
+void MusicDownloadCacheManager::changed()
+{
+    if(!m_timer.isActive())
+    {
+        m_timer.start();
+    }
+}
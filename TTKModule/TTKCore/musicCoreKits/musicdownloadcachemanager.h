@@ -0,0 +1,144 @@
+#ifndef MUSICDOWNLOADCACHEMANAGER_H
+#define MUSICDOWNLOADCACHEMANAGER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QMap>
+#include <QHash>
+#include <QTimer>
+#include "ttksingleton.h"
+#include "musicobject.h"
+
+/*! @brief The class of the download cache item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicDownloadCacheItem
+{
+    qint64 m_size;
+    qint64 m_time;
+
+    MusicDownloadCacheItem()
+    {
+        m_size = 0;
+        m_time = 0;
+    }
+}MusicDownloadCacheItem;
+
+
+/*! @brief The class of the download cache manager.
+ * Keeps size and last access time of the files in the cache and art dirs
+ * in a persistent index, files are recorded when a download lands or when
+ * they are accessed. Least recently used files are removed as soon as the
+ * cache size limit is exceeded, so the cache dirs are never walked.
+ * It should be used in main thread only.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicDownloadCacheManager : public QObject
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicDownloadCacheManager)
+public:
+    /*!
+     * Load cache index from file.
+     */
+    bool readCache(const QString &path = DOWNLOADCACHEPATH_FULL);
+    /*!
+     * Save cache index into file.
+     */
+    bool writeCache(const QString &path = DOWNLOADCACHEPATH_FULL);
+
+    /*!
+     * Record downloaded file by path and remove expired files.
+     */
+    void insert(const QString &path);
+    /*!
+     * Refresh file access time by path, record it if it is not indexed.
+     */
+    void touch(const QString &path);
+    /*!
+     * Remove file index by path.
+     */
+    void remove(const QString &path);
+    /*!
+     * Remove all file indexes under given dir.
+     */
+    void removeByDir(const QString &dir);
+
+    /*!
+     * Get current cache size.
+     */
+    inline qint64 cacheSize() const { return m_currentSize; }
+    /*!
+     * Get maximum cache size, negative if cache size is not limited.
+     */
+    qint64 maximumCacheSize() const;
+
+public Q_SLOTS:
+    /*!
+     * Remove least recently used files until the size limit.
+     */
+    void checkCacheSize();
+
+private Q_SLOTS:
+    /*!
+     * Save changed cache index into file.
+     */
+    void saveCache();
+
+private:
+    /*!
+     * Object contsructor.
+     */
+    MusicDownloadCacheManager();
+
+    /*!
+     * Load cache index at first use.
+     */
+    void loadCache();
+    /*!
+     * Get index key of given file, empty if it is not in the cache dirs.
+     */
+    QString cacheKey(const QString &path) const;
+    /*!
+     * Record file with given size as the most recently used one.
+     */
+    void append(const QString &path, qint64 size);
+    /*!
+     * Remove file index by path, remove file too if needed.
+     */
+    void take(const QString &path, bool file);
+    /*!
+     * Schedule cache index saving.
+     */
+    void changed();
+
+    bool m_loaded;
+    qint64 m_currentSize, m_lastTime;
+    QTimer m_timer;
+    QMap<qint64, QString> m_order;
+    QHash<QString, MusicDownloadCacheItem> m_items;
+
+    DECLARE_SINGLETON_CLASS(MusicDownloadCacheManager)
+
+};
+
+#define G_DOWNLOAD_CACHE_PTR GetMusicDownloadCacheManager()
+TTK_MODULE_EXPORT MusicDownloadCacheManager* GetMusicDownloadCacheManager();
+
+#endif // MUSICDOWNLOADCACHEMANAGER_H
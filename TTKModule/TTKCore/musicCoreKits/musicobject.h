@@ -119,6 +119,7 @@
 #define ART_DIR                 "MArt/"
 #define BACKGROUND_DIR          "MBackground/"
 #define CACHE_DIR               "MCached/"
+#define NETWORK_DIR             "MNetwork/"
 #define SCREEN_DIR              "MScreen/"
 //
 #define AVATAR_DIR              "avatar/"
@@ -148,6 +149,11 @@
 #define DARABASEPATH            "musicuser.dll"
 #define USERPATH                "musicuser.ttk"
 #define BARRAGEPATH             "musicbarrage.ttk"
+#define LIBRARYPATH             "musiclibrary.ttk"
+#define SCANPATH                "musicscan.ttk"
+#define PREFETCHPATH            "musicprefetch.ttk"
+#define PLAYLISTPATH            "musicplaylist.ttk"
+#define DOWNLOADCACHEPATH       "musiccache.ttk"
 
 
 //
@@ -169,6 +175,7 @@
 #define UPDATE_DIR_FULL         DOWNLOADS_DIR_FULL + UPDATE_DIR
 //
 #define CACHE_DIR_FULL          APPCACHE_DIR_FULL + CACHE_DIR
+#define NETWORK_DIR_FULL        APPCACHE_DIR_FULL + NETWORK_DIR
 #define ART_DIR_FULL            APPCACHE_DIR_FULL + ART_DIR
 #define BACKGROUND_DIR_FULL     APPCACHE_DIR_FULL + BACKGROUND_DIR
 #define SCREEN_DIR_FULL         APPCACHE_DIR_FULL + SCREEN_DIR
@@ -183,6 +190,11 @@
 #define DARABASEPATH_FULL       APPDATA_DIR_FULL + DARABASEPATH
 #define USERPATH_FULL           APPDATA_DIR_FULL + USERPATH
 #define BARRAGEPATH_FULL        APPDATA_DIR_FULL + BARRAGEPATH
+#define LIBRARYPATH_FULL        APPDATA_DIR_FULL + LIBRARYPATH
+#define SCANPATH_FULL           APPDATA_DIR_FULL + SCANPATH
+#define PREFETCHPATH_FULL       APPDATA_DIR_FULL + PREFETCHPATH
+#define PLAYLISTPATH_FULL       APPDATA_DIR_FULL + PLAYLISTPATH
+#define DOWNLOADCACHEPATH_FULL  APPDATA_DIR_FULL + DOWNLOADCACHEPATH
 #define AVATAR_DIR_FULL         APPDATA_DIR_FULL + AVATAR_DIR
 #define USER_THEME_DIR_FULL     APPDATA_DIR_FULL + USER_THEME_DIR
 
@@ -263,6 +275,7 @@ namespace MusicObject
         QString m_year;
         QString m_discNumber;
         QString m_trackNumber;
+        QString m_queryServer;
     }MusicSongInformation;
     TTK_DECLARE_LISTS(MusicSongInformation)
 
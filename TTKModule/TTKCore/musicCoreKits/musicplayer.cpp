@@ -17,11 +17,15 @@ MusicPlayer::MusicPlayer(QObject *parent)
     m_posOnCircle = 0;
     m_volumeMusic3D = 0;
     m_duration = 0;
-    m_durationTimes = 0;
+    m_nextIndex = -1;
 
     setEnabledEffect(false);
 
     connect(&m_timer, SIGNAL(timeout()), SLOT(update()));
+    connect(m_music, SIGNAL(elapsedChanged(qint64)), SIGNAL(positionChanged(qint64)));
+    connect(m_music, SIGNAL(nextTrackRequest()), SLOT(nextTrackRequest()));
+    connect(m_music, SIGNAL(trackInfoChanged()), SLOT(trackInfoChanged()));
+    connect(m_music, SIGNAL(finished()), SLOT(finished()));
     G_CONNECTION_PTR->setValue(getClassName(), this);
 }
 
@@ -140,6 +144,7 @@ void MusicPlayer::play()
     }
 
     m_currentMedia = m_playlist->currentMediaPath();
+    m_nextMedia.clear();
     ///The current playback path
     if(!m_music->play(m_currentMedia))
     {
@@ -147,11 +152,11 @@ void MusicPlayer::play()
         return;
     }
 
-    m_durationTimes = 0;
+    m_duration = -1;
     m_timer.start(MT_S2MS);
 
-    queryCurrentDuration();
-    ///Every second Q_EMITs a signal change information
+    ///Duration comes with track info, query once later in case the decoder never reports it
+    QTimer::singleShot(MT_S2MS, this, SLOT(queryCurrentDuration()));
     Q_EMIT positionChanged(0);
 }
 
@@ -166,6 +171,7 @@ void MusicPlayer::stop()
 {
     m_music->stop();
     m_timer.stop();
+    m_nextMedia.clear();
     m_state = MusicObject::PS_StoppedState;
 }
 
@@ -220,13 +226,12 @@ void MusicPlayer::setEqInformation()
 void MusicPlayer::removeCurrentMedia()
 {
     m_timer.stop();
+    m_nextMedia.clear();
     m_music->stop();
 }
 
 void MusicPlayer::update()
 {
-    Q_EMIT positionChanged(position());
-
     if(m_musicEnhanced == Enhanced3D && !isMuted())
     {
         ///3D music settings
@@ -235,41 +240,103 @@ void MusicPlayer::update()
         m_music->setVolume(fabs(100 * cosf(m_posOnCircle)), fabs(100 * sinf(m_posOnCircle * 0.5f)));
     }
 
+    ///Track end is delivered by sound core, only the error state is left to check here
     const Qmmp::State state = m_music->state();
-    if(state != Qmmp::Playing && state != Qmmp::Paused)
+    if(state == Qmmp::NormalError || state == Qmmp::FatalError)
+    {
+        finished();
+    }
+}
+
+void MusicPlayer::queryCurrentDuration()
+{
+    if(m_duration < 0)
+    {
+        Q_EMIT durationChanged(m_duration = duration());
+    }
+}
+
+void MusicPlayer::nextTrackRequest()
+{
+    m_nextMedia.clear();
+    if(!m_playlist || m_playlist->playbackMode() == MusicObject::PM_PlayOnce)
+    {
+        return;
+    }
+
+    const int index = m_playlist->nextIndex();
+    if(index < 0)
+    {
+        return;
+    }
+
+    const QString &path = m_playlist->mediaList()->at(index).m_path;
+    if(!path.isEmpty() && m_music->play(path, true))
+    {
+        m_nextIndex = index;
+        m_nextMedia = path;
+    }
+}
+
+void MusicPlayer::trackInfoChanged()
+{
+    if(!m_nextMedia.isEmpty() && m_music->path() == m_nextMedia)
     {
-        m_timer.stop();
-        if(m_playlist->playbackMode() == MusicObject::PM_PlayOnce)
+        ///Queued media has been started by sound core without gap
+        m_currentMedia = m_nextMedia;
+        m_nextMedia.clear();
+        m_duration = -1;
+
+        ///the playlist may be changed after the media was queued, index must still point to it
+        const MusicPlayItems *items = m_playlist->mediaList();
+        if(m_nextIndex < 0 || m_nextIndex >= items->count() || items->at(m_nextIndex).m_path != m_currentMedia)
         {
-            m_music->stop();
-            Q_EMIT positionChanged(0);
-            Q_EMIT stateChanged(MusicObject::PS_StoppedState);
-            return;
+            m_nextIndex = -1;
+            for(int i = 0; i < items->count(); ++i)
+            {
+                if(items->at(i).m_path == m_currentMedia)
+                {
+                    m_nextIndex = i;
+                    break;
+                }
+            }
         }
 
-        m_playlist->setCurrentIndex();
-        if(m_playlist->playbackMode() == MusicObject::PM_PlayOrder && m_playlist->currentIndex() == -1)
+        if(m_nextIndex >= 0)
         {
-            m_music->stop();
-            Q_EMIT positionChanged(0);
-            Q_EMIT stateChanged(MusicObject::PS_StoppedState);
-            return;
+            m_playlist->setCurrentIndex(m_nextIndex);
         }
-        play();
+        Q_EMIT positionChanged(0);
+    }
+
+    const qint64 dur = duration();
+    if(dur > 0 && dur != m_duration)
+    {
+        Q_EMIT durationChanged(m_duration = dur);
     }
 }
 
-void MusicPlayer::queryCurrentDuration()
+void MusicPlayer::finished()
 {
-    const qint64 dur = duration();
-    if((dur == 0 || m_duration == dur) && m_durationTimes++ < 10)
+    m_timer.stop();
+    m_nextMedia.clear();
+    if(m_playlist->playbackMode() == MusicObject::PM_PlayOnce)
     {
-        QTimer::singleShot(50 * MT_MS, this, SLOT(queryCurrentDuration()));
+        m_music->stop();
+        Q_EMIT positionChanged(0);
+        Q_EMIT stateChanged(MusicObject::PS_StoppedState);
+        return;
     }
-    else
+
+    m_playlist->setCurrentIndex();
+    if(m_playlist->playbackMode() == MusicObject::PM_PlayOrder && m_playlist->currentIndex() == -1)
     {
-        Q_EMIT durationChanged(m_duration = dur);
+        m_music->stop();
+        Q_EMIT positionChanged(0);
+        Q_EMIT stateChanged(MusicObject::PS_StoppedState);
+        return;
     }
+    play();
 }
 
 void MusicPlayer::setMusicEnhancedCase()
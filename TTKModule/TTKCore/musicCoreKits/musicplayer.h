@@ -171,6 +171,18 @@ private Q_SLOTS:
      * Query current duration by time out.
      */
     void queryCurrentDuration();
+    /*!
+     * Sound core requests next track, enqueue it for gapless playback.
+     */
+    void nextTrackRequest();
+    /*!
+     * Sound core track information changed.
+     */
+    void trackInfoChanged();
+    /*!
+     * Sound core playback finished.
+     */
+    void finished();
 
 protected:
     /*!
@@ -182,11 +194,11 @@ protected:
     MusicObject::PlayState m_state;
     SoundCore *m_music;
     QTimer m_timer;
-    QString m_currentMedia;
+    QString m_currentMedia, m_nextMedia;
     Enhanced m_musicEnhanced;
     qint64 m_duration;
 
-    int m_durationTimes;
+    int m_nextIndex;
     int m_volumeMusic3D;
     float m_posOnCircle;
 
@@ -6,6 +6,7 @@ MusicPlaylist::MusicPlaylist(QObject *parent)
 {
     MusicTime::initRandom();
     m_currentIndex = -1;
+    m_nextRandomIndex = -1;
     m_playbackMode = MusicObject::PM_PlayOrder;
 }
 
@@ -54,6 +55,49 @@ QString MusicPlaylist::currentMediaPath() const
     return currentItem().m_path;
 }
 
+int MusicPlaylist::nextIndex()
+{
+    if(m_mediaList.isEmpty())
+    {
+        return -1;
+    }
+
+    if(!m_queueMediaList.isEmpty())
+    {
+        const int index = m_queueMediaList.first().m_toolIndex;
+        return (index < 0 || index >= m_mediaList.count()) ? -1 : index;
+    }
+
+    int index = m_currentIndex;
+    switch(m_playbackMode)
+    {
+        case MusicObject::PM_PlayOneLoop: break;
+        case MusicObject::PM_PlayOrder:
+            if(++index >= m_mediaList.count())
+            {
+                index = -1;
+            }
+            break;
+        case MusicObject::PM_PlaylistLoop:
+            if(++index >= m_mediaList.count())
+            {
+                index = 0;
+            }
+            break;
+        case MusicObject::PM_PlayRandom:
+            ///keep the random index, so that the next set current index uses the same one
+            if(m_nextRandomIndex < 0 || m_nextRandomIndex >= m_mediaList.count())
+            {
+                m_nextRandomIndex = rand() % m_mediaList.count();
+            }
+            index = m_nextRandomIndex;
+            break;
+        case MusicObject::PM_PlayOnce: break;
+        default: break;
+    }
+    return index;
+}
+
 MusicPlayItems *MusicPlaylist::mediaList()
 {
     return &m_mediaList;
@@ -198,7 +242,11 @@ void MusicPlaylist::setCurrentIndex(int index)
                 }
                 break;
             case MusicObject::PM_PlayRandom:
-                m_currentIndex = rand() % m_mediaList.count();
+                if(m_nextRandomIndex < 0 || m_nextRandomIndex >= m_mediaList.count())
+                {
+                    m_nextRandomIndex = rand() % m_mediaList.count();
+                }
+                m_currentIndex = m_nextRandomIndex;
                 break;
             case MusicObject::PM_PlayOnce :
                 break;
@@ -209,6 +257,7 @@ void MusicPlaylist::setCurrentIndex(int index)
     {
         m_currentIndex = index;
     }
+    m_nextRandomIndex = -1;
 
     if(!m_queueMediaList.isEmpty())
     {
@@ -89,6 +89,10 @@ public:
      * Get current play music media path.
      */
     QString currentMediaPath() const;
+    /*!
+     * Get the index which will be played after current one, -1 if none.
+     */
+    int nextIndex();
 
     /*!
      * Get all music media path.
@@ -188,7 +192,7 @@ public Q_SLOTS:
     void setCurrentIndex(int toolIndex, const QString &path);
 
 protected:
-    int m_currentIndex;
+    int m_currentIndex, m_nextRandomIndex;
     MusicPlayItems m_mediaList;
     MusicPlayItems m_queueMediaList;
     MusicObject::PlayMode m_playbackMode;
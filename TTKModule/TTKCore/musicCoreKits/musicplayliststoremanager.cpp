@@ -0,0 +1,567 @@
+#include "musicplayliststoremanager.h"
+
+#include <QDir>
+#include <QtEndian>
+#include <QDataStream>
+
+#define PLAYLIST_MAGIC          0x4C504B54
+#define JOURNAL_MAGIC           0x4A504B54
+#define PLAYLIST_VERSION        1
+#define PLAYLIST_HEADER_SIZE    32
+#define PLAYLIST_ITEM_SIZE      24
+#define PLAYLIST_SONG_SIZE      16
+#define PLAYLIST_STRING_SIZE    8
+#define JOURNAL_HEADER_SIZE     12
+#define JOURNAL_RECORD_SIZE     8
+#define JOURNAL_COMPACT_COUNT   512
+
+/*! Binary layout, all integers are little endian.
+ *  header:  magic(u32) version(u32) generation(u32) itemCount(u32) songCount(u32) stringCount(u32) reserved(u64)
+ *  item:    name(u32) index(i32) sortIndex(i32) sortType(i32) firstSong(u32) songCount(u32)
+ *  song:    path(u32) name(u32) playTime(u32) playCount(i32)
+ *  string:  offset(u32) length(u32) into the utf8 pool after string table
+ *  journal: magic(u32) version(u32) generation(u32), then length(u32) type(u32) payload records
+ *
+ *  Journals whose generation is not greater than the snapshot's are already folded into it.
+ */
+
+static QString journalPath(const QString &path, quint32 generation)
+{
+    return QString("%1.%2.jnl").arg(path).arg(generation);
+}
+
+static QStringList journalFiles(const QString &path)
+{
+    const QFileInfo info(path);
+    QStringList files;
+    for(const QFileInfo &file : QDir(info.absolutePath()).entryInfoList(QStringList() << info.fileName() + ".*.jnl", QDir::Files))
+    {
+        files << file.absoluteFilePath();
+    }
+    return files;
+}
+
+static void writeSong(QDataStream &stream, const MusicSong &song)
+{
+    stream << song.getMusicPath() << song.getMusicName() << song.getMusicPlayTime() << qint32(song.getMusicPlayCount());
+}
+
+static MusicSong readSong(QDataStream &stream)
+{
+    QString path, name, playTime;
+    qint32 playCount = 0;
+    stream >> path >> name >> playTime >> playCount;
+    return MusicSong(path, playCount, playTime, name);
+}
+
+
+MusicPlaylistStoreThread::MusicPlaylistStoreThread(QObject *parent)
+    : MusicAbstractThread(parent)
+{
+    m_generation = 0;
+}
+
+void MusicPlaylistStoreThread::setCompactData(const QString &path, const MusicSongItems &items, quint32 generation)
+{
+    m_path = path;
+    m_items = items;
+    m_generation = generation;
+}
+
+void MusicPlaylistStoreThread::run()
+{
+    MusicAbstractThread::run();
+
+    if(MusicPlaylistStoreManager::writeSnapshot(m_path, m_items, m_generation))
+    {
+        MusicPlaylistStoreManager::removeJournals(m_path, m_generation);
+    }
+    m_items.clear();
+}
+
+
+
+MusicPlaylistStoreManager::MusicPlaylistStoreManager()
+{
+    m_generation = 1;
+    m_recordCount = 0;
+    m_dirty = false;
+    m_thread = new MusicPlaylistStoreThread;
+}
+
+MusicPlaylistStoreManager::~MusicPlaylistStoreManager()
+{
+    m_thread->stopAndQuitThread();
+    delete m_thread;
+    m_journal.close();
+}
+
+bool MusicPlaylistStoreManager::readPlaylist(MusicSongItems &items, const QString &path)
+{
+    m_path = path;
+    m_dirty = false;
+
+    quint32 generation = 0;
+    bool success = readSnapshot(path, items, generation);
+    if(!success)
+    {
+        items.clear();
+    }
+
+    quint32 last = generation;
+    QList<QPair<quint32, QString> > journals;
+    for(const QString &file : journalFiles(path))
+    {
+        QFile journal(file);
+        uchar header[JOURNAL_HEADER_SIZE];
+        if(journal.open(QIODevice::ReadOnly) && journal.read(TTKReinterpret_cast(char*, header), JOURNAL_HEADER_SIZE) == JOURNAL_HEADER_SIZE &&
+           qFromLittleEndian<quint32>(header) == JOURNAL_MAGIC)
+        {
+            journals << qMakePair(qFromLittleEndian<quint32>(header + 8), file);
+        }
+    }
+    std::sort(journals.begin(), journals.end());
+
+    for(const auto &journal : qAsConst(journals))
+    {
+        last = qMax(last, journal.first);
+        if(!success)
+        {
+            ///journals without their base snapshot can not be replayed, keep them aside
+            ///so that the compaction of the migrated playlist does not remove them
+            TTK_LOGGER_ERROR(QString("Playlist journal %1 can not be replayed, keep it aside").arg(journal.second));
+            QFile::rename(journal.second, journal.second + ".bak");
+        }
+        else if(journal.first > generation && readJournal(journal.second, items) != 0)
+        {
+            m_dirty = true;
+        }
+    }
+
+    ///every session starts its own journal
+    m_generation = last + 1;
+    m_items = items;
+    return success;
+}
+
+bool MusicPlaylistStoreManager::writePlaylist(const MusicSongItems &items)
+{
+    m_thread->stopAndQuitThread();
+    m_journal.close();
+
+    m_items = items;
+    if(m_path.isEmpty() || !writeSnapshot(m_path, m_items, m_generation))
+    {
+        return false;
+    }
+
+    removeJournals(m_path, m_generation);
+    ++m_generation;
+    m_recordCount = 0;
+    m_dirty = false;
+    return true;
+}
+
+void MusicPlaylistStoreManager::resetPlaylist(const MusicSongItems &items)
+{
+    m_dirty |= items.count() != m_items.count();
+    m_items = items;
+
+    if(m_dirty)
+    {
+        compact();
+    }
+}
+
+void MusicPlaylistStoreManager::updateItem(int index, const MusicSongItem &item)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream << qint32(index) << qint32(item.m_itemIndex) << item.m_itemName << qint32(item.m_sort.m_index) << qint32(item.m_sort.m_sortType);
+    stream << qint32(item.m_songs.count());
+    for(const MusicSong &song : qAsConst(item.m_songs))
+    {
+        writeSong(stream, song);
+    }
+    appendRecord(UpdateItem, payload);
+}
+
+void MusicPlaylistStoreManager::removeItem(int index)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream << qint32(index);
+    appendRecord(RemoveItem, payload);
+}
+
+void MusicPlaylistStoreManager::moveItem(int from, int to)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream << qint32(from) << qint32(to);
+    appendRecord(MoveItem, payload);
+}
+
+void MusicPlaylistStoreManager::updateSong(int index, int row, const MusicSong &song)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream << qint32(index) << qint32(row);
+    writeSong(stream, song);
+    appendRecord(UpdateSong, payload);
+}
+
+bool MusicPlaylistStoreManager::writeSnapshot(const QString &path, const MusicSongItems &items, quint32 generation)
+{
+    QHash<QString, quint32> interned;
+    QStringList strings;
+    const auto intern = [&interned, &strings](const QString &value) -> quint32
+    {
+        auto it = interned.constFind(value);
+        if(it != interned.constEnd())
+        {
+            return it.value();
+        }
+
+        const quint32 id = strings.count();
+        interned.insert(value, id);
+        strings << value;
+        return id;
+    };
+
+    int songCount = 0;
+    for(const MusicSongItem &item : qAsConst(items))
+    {
+        songCount += item.m_songs.count();
+    }
+
+    QByteArray itemRecords(items.count() * PLAYLIST_ITEM_SIZE, 0), songRecords(songCount * PLAYLIST_SONG_SIZE, 0);
+    int first = 0;
+    for(int i=0; i<items.count(); ++i)
+    {
+        const MusicSongItem &item = items[i];
+        uchar *record = TTKReinterpret_cast(uchar*, itemRecords.data()) + i * PLAYLIST_ITEM_SIZE;
+        qToLittleEndian<quint32>(intern(item.m_itemName), record);
+        qToLittleEndian<qint32>(item.m_itemIndex, record + 4);
+        qToLittleEndian<qint32>(item.m_sort.m_index, record + 8);
+        qToLittleEndian<qint32>(item.m_sort.m_sortType, record + 12);
+        qToLittleEndian<quint32>(first, record + 16);
+        qToLittleEndian<quint32>(item.m_songs.count(), record + 20);
+
+        for(const MusicSong &song : qAsConst(item.m_songs))
+        {
+            record = TTKReinterpret_cast(uchar*, songRecords.data()) + first++ * PLAYLIST_SONG_SIZE;
+            qToLittleEndian<quint32>(intern(song.getMusicPath()), record);
+            qToLittleEndian<quint32>(intern(song.getMusicName()), record + 4);
+            qToLittleEndian<quint32>(intern(song.getMusicPlayTime()), record + 8);
+            qToLittleEndian<qint32>(song.getMusicPlayCount(), record + 12);
+        }
+    }
+
+    QByteArray stringRecords(strings.count() * PLAYLIST_STRING_SIZE, 0), pool;
+    for(int i=0; i<strings.count(); ++i)
+    {
+        const QByteArray &data = strings[i].toUtf8();
+        uchar *record = TTKReinterpret_cast(uchar*, stringRecords.data()) + i * PLAYLIST_STRING_SIZE;
+        qToLittleEndian<quint32>(pool.size(), record);
+        qToLittleEndian<quint32>(data.size(), record + 4);
+        pool.append(data);
+    }
+
+    uchar header[PLAYLIST_HEADER_SIZE] = {0};
+    qToLittleEndian<quint32>(PLAYLIST_MAGIC, header);
+    qToLittleEndian<quint32>(PLAYLIST_VERSION, header + 4);
+    qToLittleEndian<quint32>(generation, header + 8);
+    qToLittleEndian<quint32>(items.count(), header + 12);
+    qToLittleEndian<quint32>(songCount, header + 16);
+    qToLittleEndian<quint32>(strings.count(), header + 20);
+
+    ///write aside and swap, so that a crash never leaves a broken snapshot
+    const QString &temp = path + ".tmp";
+    QFile file(temp);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    file.write(TTKReinterpret_cast(const char*, header), PLAYLIST_HEADER_SIZE);
+    file.write(itemRecords);
+    file.write(songRecords);
+    file.write(stringRecords);
+    file.write(pool);
+    const bool success = file.error() == QFile::NoError;
+    file.close();
+
+    if(!success)
+    {
+        QFile::remove(temp);
+        return false;
+    }
+
+    QFile::remove(path);
+    return QFile::rename(temp, path);
+}
+
+void MusicPlaylistStoreManager::removeJournals(const QString &path, quint32 generation)
+{
+    for(const QString &file : journalFiles(path))
+    {
+        ///a journal whose header is not written yet may be the one just opened, keep it
+        QFile journal(file);
+        uchar header[JOURNAL_HEADER_SIZE];
+        if(journal.open(QIODevice::ReadOnly) && journal.read(TTKReinterpret_cast(char*, header), JOURNAL_HEADER_SIZE) == JOURNAL_HEADER_SIZE &&
+           qFromLittleEndian<quint32>(header) == JOURNAL_MAGIC && qFromLittleEndian<quint32>(header + 8) <= generation)
+        {
+            journal.close();
+            journal.remove();
+        }
+    }
+}
+
+bool MusicPlaylistStoreManager::readSnapshot(const QString &path, MusicSongItems &items, quint32 &generation)
+{
+    QFile file(path);
+    if(!file.exists())
+    {
+        ///crashed between removing the old snapshot and renaming the new one
+        file.setFileName(path + ".tmp");
+    }
+
+    if(!file.open(QIODevice::ReadOnly) || file.size() < PLAYLIST_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    const qint64 size = file.size();
+    const uchar *data = file.map(0, size);
+    QByteArray buffer;
+    if(!data)
+    {
+        buffer = file.readAll();
+        data = TTKReinterpret_cast(const uchar*, buffer.constData());
+    }
+
+    const quint32 magic = qFromLittleEndian<quint32>(data);
+    const quint32 version = qFromLittleEndian<quint32>(data + 4);
+    const quint32 itemCount = qFromLittleEndian<quint32>(data + 12);
+    const quint32 songCount = qFromLittleEndian<quint32>(data + 16);
+    const quint32 stringCount = qFromLittleEndian<quint32>(data + 20);
+
+    const qint64 songOffset = PLAYLIST_HEADER_SIZE + qint64(itemCount) * PLAYLIST_ITEM_SIZE;
+    const qint64 stringOffset = songOffset + qint64(songCount) * PLAYLIST_SONG_SIZE;
+    const qint64 poolOffset = stringOffset + qint64(stringCount) * PLAYLIST_STRING_SIZE;
+
+    if(magic != PLAYLIST_MAGIC || version != PLAYLIST_VERSION || poolOffset > size)
+    {
+        TTK_LOGGER_ERROR("Playlist store is invalid, ignore it");
+        return false;
+    }
+
+    QStringList strings;
+    strings.reserve(stringCount);
+    for(quint32 i=0; i<stringCount; ++i)
+    {
+        const uchar *record = data + stringOffset + i * PLAYLIST_STRING_SIZE;
+        const quint32 offset = qFromLittleEndian<quint32>(record);
+        const quint32 length = qFromLittleEndian<quint32>(record + 4);
+        if(poolOffset + offset + length > size)
+        {
+            TTK_LOGGER_ERROR("Playlist store is invalid, ignore it");
+            return false;
+        }
+        strings << QString::fromUtf8(TTKReinterpret_cast(const char*, data + poolOffset + offset), length);
+    }
+
+    const auto string = [&strings](quint32 id) -> QString
+    {
+        return id < quint32(strings.count()) ? strings[id] : QString();
+    };
+
+    items.clear();
+    for(quint32 i=0; i<itemCount; ++i)
+    {
+        const uchar *record = data + PLAYLIST_HEADER_SIZE + i * PLAYLIST_ITEM_SIZE;
+        const quint32 first = qFromLittleEndian<quint32>(record + 16);
+        const quint32 count = qFromLittleEndian<quint32>(record + 20);
+        if(qint64(first) + count > songCount)
+        {
+            TTK_LOGGER_ERROR("Playlist store is invalid, ignore it");
+            items.clear();
+            return false;
+        }
+
+        MusicSongItem item;
+        item.m_itemName = string(qFromLittleEndian<quint32>(record));
+        item.m_itemIndex = qFromLittleEndian<qint32>(record + 4);
+        item.m_sort.m_index = qFromLittleEndian<qint32>(record + 8);
+        item.m_sort.m_sortType = TTKStatic_cast(Qt::SortOrder, qFromLittleEndian<qint32>(record + 12));
+
+        item.m_songs.reserve(count);
+        for(quint32 j=first; j<first + count; ++j)
+        {
+            const uchar *song = data + songOffset + j * PLAYLIST_SONG_SIZE;
+            item.m_songs << MusicSong(string(qFromLittleEndian<quint32>(song)),
+                                      qFromLittleEndian<qint32>(song + 12),
+                                      string(qFromLittleEndian<quint32>(song + 8)),
+                                      string(qFromLittleEndian<quint32>(song + 4)));
+        }
+        items << item;
+    }
+
+    generation = qFromLittleEndian<quint32>(data + 8);
+    return true;
+}
+
+quint32 MusicPlaylistStoreManager::readJournal(const QString &path, MusicSongItems &items)
+{
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        return 0;
+    }
+
+    const QByteArray &data = file.readAll();
+    const uchar *header = TTKReinterpret_cast(const uchar*, data.constData());
+    if(data.size() < JOURNAL_HEADER_SIZE || qFromLittleEndian<quint32>(header) != JOURNAL_MAGIC || qFromLittleEndian<quint32>(header + 4) != PLAYLIST_VERSION)
+    {
+        return 0;
+    }
+
+    int offset = JOURNAL_HEADER_SIZE;
+    while(offset + JOURNAL_RECORD_SIZE <= data.size())
+    {
+        const uchar *record = header + offset;
+        const quint32 length = qFromLittleEndian<quint32>(record);
+        const quint32 type = qFromLittleEndian<quint32>(record + 4);
+        if(offset + JOURNAL_RECORD_SIZE + qint64(length) > data.size())
+        {
+            ///the last record was cut by a crash
+            break;
+        }
+
+        applyRecord(type, data.mid(offset + JOURNAL_RECORD_SIZE, length), items);
+        offset += JOURNAL_RECORD_SIZE + length;
+    }
+    return qFromLittleEndian<quint32>(header + 8);
+}
+
+void MusicPlaylistStoreManager::applyRecord(int type, const QByteArray &payload, MusicSongItems &items)
+{
+    QDataStream stream(payload);
+    switch(type)
+    {
+        case UpdateItem:
+            {
+                qint32 index = 0, itemIndex = 0, sortIndex = 0, sortType = 0, count = 0;
+                MusicSongItem item;
+                stream >> index >> itemIndex >> item.m_itemName >> sortIndex >> sortType >> count;
+                item.m_itemIndex = itemIndex;
+                item.m_sort.m_index = sortIndex;
+                item.m_sort.m_sortType = TTKStatic_cast(Qt::SortOrder, sortType);
+                for(int i=0; i<count && !stream.atEnd(); ++i)
+                {
+                    item.m_songs << readSong(stream);
+                }
+
+                if(index >= 0 && index < items.count())
+                {
+                    items[index] = item;
+                }
+                else if(index == items.count())
+                {
+                    items << item;
+                }
+                break;
+            }
+        case RemoveItem:
+            {
+                qint32 index = -1;
+                stream >> index;
+                if(index >= 0 && index < items.count())
+                {
+                    items.removeAt(index);
+                }
+                break;
+            }
+        case MoveItem:
+            {
+                qint32 from = -1, to = -1;
+                stream >> from >> to;
+                if(from >= 0 && from < items.count() && to >= 0 && to < items.count())
+                {
+                    items.move(from, to);
+                }
+                break;
+            }
+        case UpdateSong:
+            {
+                qint32 index = -1, row = -1;
+                stream >> index >> row;
+                const MusicSong &song = readSong(stream);
+                if(index >= 0 && index < items.count() && row >= 0 && row < items[index].m_songs.count())
+                {
+                    items[index].m_songs[row] = song;
+                    items[index].invalidateSongIndex();
+                }
+                break;
+            }
+        default: break;
+    }
+}
+
+void MusicPlaylistStoreManager::appendRecord(int type, const QByteArray &payload)
+{
+    if(m_path.isEmpty())
+    {
+        return;
+    }
+
+    applyRecord(type, payload, m_items);
+
+    if(!m_journal.isOpen())
+    {
+        m_journal.setFileName(journalPath(m_path, m_generation));
+        if(!m_journal.open(QIODevice::WriteOnly | QIODevice::Append))
+        {
+            TTK_LOGGER_ERROR("Playlist journal open error");
+            return;
+        }
+
+        if(m_journal.size() == 0)
+        {
+            uchar header[JOURNAL_HEADER_SIZE];
+            qToLittleEndian<quint32>(JOURNAL_MAGIC, header);
+            qToLittleEndian<quint32>(PLAYLIST_VERSION, header + 4);
+            qToLittleEndian<quint32>(m_generation, header + 8);
+            m_journal.write(TTKReinterpret_cast(const char*, header), JOURNAL_HEADER_SIZE);
+        }
+    }
+
+    uchar record[JOURNAL_RECORD_SIZE];
+    qToLittleEndian<quint32>(payload.size(), record);
+    qToLittleEndian<quint32>(type, record + 4);
+    m_journal.write(TTKReinterpret_cast(const char*, record), JOURNAL_RECORD_SIZE);
+    m_journal.write(payload);
+    m_journal.flush();
+
+    if(++m_recordCount >= JOURNAL_COMPACT_COUNT)
+    {
+        compact();
+    }
+}
+
+void MusicPlaylistStoreManager::compact()
+{
+    if(m_path.isEmpty() || m_thread->isRunning())
+    {
+        return;
+    }
+
+    ///the snapshot covers the current journal, later records go to a new one
+    m_journal.close();
+    m_thread->setCompactData(m_path, m_items, m_generation);
+    ++m_generation;
+    m_recordCount = 0;
+    m_dirty = false;
+    m_thread->start();
+}
@@ -0,0 +1,159 @@
+#ifndef MUSICPLAYLISTSTOREMANAGER_H
+#define MUSICPLAYLISTSTOREMANAGER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QFile>
+#include "ttksingleton.h"
+#include "musicsong.h"
+#include "musicabstractthread.h"
+
+/*! @brief The class of the music playlist store compact thread.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicPlaylistStoreThread : public MusicAbstractThread
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicPlaylistStoreThread)
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicPlaylistStoreThread(QObject *parent = nullptr);
+
+    /*!
+     * Set snapshot path, items and the journal generation they cover.
+     */
+    void setCompactData(const QString &path, const MusicSongItems &items, quint32 generation);
+
+protected:
+    /*!
+     * Thread run now.
+     */
+    virtual void run() override;
+
+    QString m_path;
+    MusicSongItems m_items;
+    quint32 m_generation;
+
+};
+
+
+/*! @brief The class of the music playlist store manager.
+ * Keeps all playlists in a binary snapshot with interned strings and
+ * fixed width records, every change after it is appended to a journal
+ * file, the journal is folded into a new snapshot in background.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicPlaylistStoreManager
+{
+    TTK_DECLARE_MODULE(MusicPlaylistStoreManager)
+public:
+    enum Record
+    {
+        UpdateItem,     /*!< replace or append one playlist*/
+        RemoveItem,     /*!< remove one playlist*/
+        MoveItem,       /*!< move one playlist*/
+        UpdateSong      /*!< replace one song of playlist*/
+    };
+
+    /*!
+     * Read snapshot and replay journals, return false if nothing stored.
+     */
+    bool readPlaylist(MusicSongItems &items, const QString &path = PLAYLISTPATH_FULL);
+    /*!
+     * Write full snapshot and drop all journals.
+     */
+    bool writePlaylist(const MusicSongItems &items);
+    /*!
+     * Reset playlists after they are loaded, compact if they are changed.
+     */
+    void resetPlaylist(const MusicSongItems &items);
+
+    /*!
+     * Journal playlist replaced or appended at index.
+     */
+    void updateItem(int index, const MusicSongItem &item);
+    /*!
+     * Journal playlist removed at index.
+     */
+    void removeItem(int index);
+    /*!
+     * Journal playlist moved from index to index.
+     */
+    void moveItem(int from, int to);
+    /*!
+     * Journal song of playlist replaced at row.
+     */
+    void updateSong(int index, int row, const MusicSong &song);
+
+    /*!
+     * Write snapshot file by given journal generation.
+     */
+    static bool writeSnapshot(const QString &path, const MusicSongItems &items, quint32 generation);
+    /*!
+     * Remove journal files covered by given generation.
+     */
+    static void removeJournals(const QString &path, quint32 generation);
+
+protected:
+    /*!
+     * Object contsructor.
+     */
+    MusicPlaylistStoreManager();
+    ~MusicPlaylistStoreManager();
+
+    /*!
+     * Read snapshot file.
+     */
+    static bool readSnapshot(const QString &path, MusicSongItems &items, quint32 &generation);
+    /*!
+     * Replay journal file, return its generation or zero if invalid.
+     */
+    static quint32 readJournal(const QString &path, MusicSongItems &items);
+    /*!
+     * Apply one journal record.
+     */
+    static void applyRecord(int type, const QByteArray &payload, MusicSongItems &items);
+
+    /*!
+     * Apply record to memory and append it to journal.
+     */
+    void appendRecord(int type, const QByteArray &payload);
+    /*!
+     * Compact journal into snapshot in background.
+     */
+    void compact();
+
+    QString m_path;
+    QFile m_journal;
+    quint32 m_generation;
+    int m_recordCount;
+    bool m_dirty;
+    MusicSongItems m_items;
+    MusicPlaylistStoreThread *m_thread;
+
+    DECLARE_SINGLETON_CLASS(MusicPlaylistStoreManager)
+
+};
+
+#define G_PLAYLIST_STORE_PTR GetMusicPlaylistStoreManager()
+TTK_MODULE_EXPORT MusicPlaylistStoreManager* GetMusicPlaylistStoreManager();
+
+#endif // MUSICPLAYLISTSTOREMANAGER_H
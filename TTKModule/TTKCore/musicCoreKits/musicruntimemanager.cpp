@@ -3,7 +3,6 @@
 #include "musicsettingmanager.h"
 #include "musicnetworkthread.h"
 #include "musicqmmputils.h"
-#include "musicfileutils.h"
 #include "musiccoreutils.h"
 #include "musiccodecutils.h"
 
@@ -31,10 +30,6 @@ void MusicRunTimeManager::run() const
     xml.readConfig();
     xml.readSysConfigData();
 
-    MusicUtils::File::checkCacheSize(
-                G_SETTING_PTR->value(MusicSettingManager::DownloadCacheSize).toInt() * MH_MB2B,
-                G_SETTING_PTR->value(MusicSettingManager::DownloadCacheLimit).toInt(),
-                G_SETTING_PTR->value(MusicSettingManager::DownloadMusicPathDir).toString());
     G_NETWORK_PTR->setBlockNetWork(
                 G_SETTING_PTR->value(MusicSettingManager::CloseNetWork).toInt());
 }
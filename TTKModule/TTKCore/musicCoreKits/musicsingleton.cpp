@@ -4,8 +4,13 @@
 #include "musichotkeymanager.h"
 #include "musicsettingmanager.h"
 #include "musicsinglemanager.h"
+#include "musicsonglibrarymanager.h"
+#include "musicplayliststoremanager.h"
+#include "musicstartupmanager.h"
+#include "musicdownloadcachemanager.h"
 #include "musicdownloadmanager.h"
 #include "musicdownloadqueryfactory.h"
+#include "musicnetworkcache.h"
 
 MusicConnectionPool* GetMusicConnectionPool()
 {
@@ -37,6 +42,26 @@ MusicSingleManager* GetMusicSingleManager()
     return TTKSingleton<MusicSingleManager>::createInstance();
 }
 
+MusicSongLibraryManager* GetMusicSongLibraryManager()
+{
+    return TTKSingleton<MusicSongLibraryManager>::createInstance();
+}
+
+MusicPlaylistStoreManager* GetMusicPlaylistStoreManager()
+{
+    return TTKSingleton<MusicPlaylistStoreManager>::createInstance();
+}
+
+MusicStartupManager* GetMusicStartupManager()
+{
+    return TTKSingleton<MusicStartupManager>::createInstance();
+}
+
+MusicDownloadCacheManager* GetMusicDownloadCacheManager()
+{
+    return TTKSingleton<MusicDownloadCacheManager>::createInstance();
+}
+
 MusicDownLoadManager* GetMusicDownLoadManager()
 {
     return TTKSingleton<MusicDownLoadManager>::createInstance();
@@ -51,3 +76,8 @@ MusicNetworkThread* GetMusicNetworkThread()
 {
     return TTKSingleton<MusicNetworkThread>::createInstance();
 }
+
+MusicNetworkCache* GetMusicNetworkCache()
+{
+    return TTKSingleton<MusicNetworkCache>::createInstance();
+}
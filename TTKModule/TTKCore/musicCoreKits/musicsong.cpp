@@ -5,6 +5,7 @@
 #include "musicformats.h"
 #include "musicextractwrapper.h"
 #include "musicsettingmanager.h"
+#include "musicsonglibrarymanager.h"
 
 MusicSong::MusicSong()
     : m_musicName(QString()), m_musicPath(QString())
@@ -28,9 +29,16 @@ MusicSong::MusicSong(const QString &musicPath, const QString &musicName)
     {
         m_musicName = info.completeBaseName();
     }
-    m_musicSize = info.size();
-    m_musicType = info.suffix();
-    m_musicAddTime = info.lastModified().currentMSecsSinceEpoch();
+
+    MusicSongLibraryItem item;
+    if(!G_LIBRARY_PTR->find(m_musicPath, item) && MusicSongLibraryManager::stat(m_musicPath, item))
+    {
+        G_LIBRARY_PTR->insert(item);
+    }
+
+    m_musicSize = item.m_size;
+    m_musicType = item.isValid() ? item.m_type : info.suffix();
+    m_musicAddTime = QDateTime::currentMSecsSinceEpoch();
     m_musicAddTimeStr = QString::number(m_musicAddTime);
     m_musicSizeStr = MusicUtils::Number::size2Label(m_musicSize);
 }
@@ -105,6 +113,64 @@ bool MusicSong::operator> (const MusicSong &other) const
 }
 
 
+int MusicSongItem::songIndex(const QString &path) const
+{
+    const QString &key = path.contains("\\") ? QString(path).replace("\\", "/") : path;
+    if(m_songIndexCount != m_songs.count())
+    {
+        updateSongIndex();
+    }
+
+    auto it = m_songIndex.constFind(key);
+    if(it == m_songIndex.constEnd())
+    {
+        return -1;
+    }
+
+    const int index = it.value();
+    if(index < m_songs.count() && m_songs[index].getMusicPath() == key)
+    {
+        return index;
+    }
+
+    updateSongIndex();
+    return m_songIndex.value(key, -1);
+}
+
+void MusicSongItem::appendSongs(const MusicSongs &songs)
+{
+    const bool valid = m_songIndexCount == m_songs.count();
+    for(const MusicSong &song : qAsConst(songs))
+    {
+        if(valid && !m_songIndex.contains(song.getMusicPath()))
+        {
+            m_songIndex.insert(song.getMusicPath(), m_songs.count());
+        }
+        m_songs << song;
+    }
+
+    if(valid)
+    {
+        m_songIndexCount = m_songs.count();
+    }
+}
+
+void MusicSongItem::updateSongIndex() const
+{
+    m_songIndex.clear();
+    m_songIndex.reserve(m_songs.count());
+    for(int i=0; i<m_songs.count(); ++i)
+    {
+        const QString &path = m_songs[i].getMusicPath();
+        if(!m_songIndex.contains(path))
+        {
+            m_songIndex.insert(path, i);
+        }
+    }
+    m_songIndexCount = m_songs.count();
+}
+
+
 MusicSongs MusicObject::generateMusicSongList(const QString &path)
 {
     MusicSongs songs;
@@ -132,7 +198,7 @@ MusicSongs MusicObject::generateMusicSongList(const QString &path)
     else if(MusicFormats::SongTrackTpyeContains(suffix))
     {
         MusicSongMeta meta;
-        if(!meta.read(path))
+        if(!meta.read(path, false))
         {
             return songs;
         }
@@ -161,16 +227,30 @@ MusicSongs MusicObject::generateMusicSongList(const QString &path)
         return songs;
     }
 
-    MusicSongMeta meta;
-    const bool state = meta.read(path);
-    const QString &time = state ? meta.getLengthString() : STRING_NULL;
+    MusicSongLibraryItem item, current;
+    const bool cached = G_LIBRARY_PTR->find(path, item) && !item.m_playTime.isEmpty();
+    if(!MusicSongLibraryManager::stat(path, current))
+    {
+        current.m_path = path;
+    }
+
+    if(!cached || item.m_size != current.m_size || item.m_modified != current.m_modified)
+    {
+        MusicSongMeta meta;
+        const bool state = meta.read(path, false);
+        current.m_playTime = state ? meta.getLengthString() : STRING_NULL;
+        current.m_title = state ? meta.getTitle() : QString();
+        current.m_artist = state ? meta.getArtist() : QString();
+        G_LIBRARY_PTR->insert(current);
+        item = current;
+    }
 
     QString name;
-    if(state && G_SETTING_PTR->value(MusicSettingManager::OtherUseInfo).toBool() && !meta.getTitle().isEmpty() && !meta.getArtist().isEmpty())
+    if(G_SETTING_PTR->value(MusicSettingManager::OtherUseInfo).toBool() && !item.m_title.isEmpty() && !item.m_artist.isEmpty())
     {
-        name = meta.getArtist() + " - " + meta.getTitle();
+        name = item.m_artist + " - " + item.m_title;
     }
-    songs << MusicSong(path, 0, time, name);
+    songs << MusicSong(path, 0, item.m_playTime, name);
 
     return songs;
 }
@@ -19,6 +19,7 @@
  * with this program; If not, see <http://www.gnu.org/licenses/>.
  ================================================= */
 
+#include <QHash>
 #include "musictime.h"
 #include "musicobject.h"
 #include "musicglobaldefine.h"
@@ -214,12 +215,40 @@ typedef struct TTK_MODULE_EXPORT MusicSongItem
     {
         m_itemIndex = -1;
         m_itemObject = nullptr;
+        m_songIndexCount = -1;
     }
 
+    /*!
+     * Find song index by path, the path index is rebuilt when out of date.
+     */
+    int songIndex(const QString &path) const;
+    /*!
+     * Check song is contains by path.
+     */
+    inline bool containsSong(const QString &path) const { return songIndex(path) != -1; }
+    /*!
+     * Append songs and keep path index in sync.
+     */
+    void appendSongs(const MusicSongs &songs);
+    /*!
+     * Mark path index out of date, it must be called after every change
+     * of m_songs that is not done by appendSongs.
+     */
+    inline void invalidateSongIndex() { m_songIndexCount = -1; }
+
     inline bool operator<(const MusicSongItem &other) const
     {
         return m_itemIndex < other.m_itemIndex;
     }
+
+private:
+    /*!
+     * Rebuild path index.
+     */
+    void updateSongIndex() const;
+
+    mutable int m_songIndexCount;
+    mutable QHash<QString, int> m_songIndex;
 }MusicSongItem;
 TTK_DECLARE_LISTS(MusicSongItem)
 
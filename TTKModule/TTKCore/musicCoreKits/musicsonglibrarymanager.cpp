@@ -0,0 +1,347 @@
+#include "musicsonglibrarymanager.h"
+
+#include <QtEndian>
+#include <QDateTime>
+#include <QFileInfo>
+
+#define LIBRARY_MAGIC           0x4C4B5454
+#define LIBRARY_VERSION         1
+#define LIBRARY_HEADER_SIZE     16
+#define LIBRARY_RECORD_SIZE     32
+
+/*! Binary layout, all integers are little endian.
+ *  header:  magic(u32) version(u32) count(u32) stringOffset(u32)
+ *  record:  key(u64) size(i64) modified(i64) offset(u32) length(u32), sorted by key
+ *  strings: utf8 path, type, playTime, title, artist separated by '\0'
+ */
+
+MusicSongLibraryThread::MusicSongLibraryThread(QObject *parent)
+    : MusicAbstractThread(parent)
+{
+
+}
+
+void MusicSongLibraryThread::run()
+{
+    MusicAbstractThread::run();
+
+    MusicSongLibraryItem item;
+    while(m_running && G_LIBRARY_PTR->takeRevalidateItem(item))
+    {
+        MusicSongLibraryItem current;
+        if(!MusicSongLibraryManager::stat(item.m_path, current))
+        {
+            G_LIBRARY_PTR->remove(item.m_path);
+            continue;
+        }
+
+        if(current.m_size != item.m_size || current.m_modified != item.m_modified)
+        {
+            G_LIBRARY_PTR->insert(current);
+        }
+    }
+}
+
+
+
+MusicSongLibraryManager::MusicSongLibraryManager()
+{
+    m_mapped = nullptr;
+    m_mappedCount = 0;
+    m_thread = new MusicSongLibraryThread;
+}
+
+MusicSongLibraryManager::~MusicSongLibraryManager()
+{
+    m_mutex.lock();
+    m_pending.clear();
+    m_mutex.unlock();
+
+    m_thread->stopAndQuitThread();
+    delete m_thread;
+    unmap();
+}
+
+bool MusicSongLibraryManager::readLibrary(const QString &path)
+{
+    QMutexLocker locker(&m_mutex);
+    unmap();
+
+    m_file.setFileName(path);
+    if(!m_file.open(QIODevice::ReadOnly) || m_file.size() < LIBRARY_HEADER_SIZE)
+    {
+        unmap();
+        return false;
+    }
+
+    const uchar *data = m_file.map(0, m_file.size());
+    if(!data)
+    {
+        unmap();
+        return false;
+    }
+
+    const quint32 magic = qFromLittleEndian<quint32>(data);
+    const quint32 version = qFromLittleEndian<quint32>(data + 4);
+    const quint32 count = qFromLittleEndian<quint32>(data + 8);
+    const quint32 offset = qFromLittleEndian<quint32>(data + 12);
+
+    if(magic != LIBRARY_MAGIC || version != LIBRARY_VERSION || offset != LIBRARY_HEADER_SIZE + count * LIBRARY_RECORD_SIZE || offset > m_file.size())
+    {
+        TTK_LOGGER_ERROR("Song library index is invalid, rebuild it");
+        m_file.unmap(TTKConst_cast(uchar*, data));
+        unmap();
+        return false;
+    }
+
+    m_mapped = data;
+    m_mappedCount = count;
+    return true;
+}
+
+bool MusicSongLibraryManager::writeLibrary(const QString &path)
+{
+    QMutexLocker locker(&m_mutex);
+
+    QList<MusicSongLibraryItem> items;
+    QList<quint64> keys;
+    for(int i=0; i<m_mappedCount; ++i)
+    {
+        const quint64 key = qFromLittleEndian<quint64>(m_mapped + LIBRARY_HEADER_SIZE + i * LIBRARY_RECORD_SIZE);
+        if(m_removed.contains(key) || m_items.contains(key))
+        {
+            continue;
+        }
+        keys << key;
+        items << readMapped(i);
+    }
+
+    for(auto it = m_items.constBegin(); it != m_items.constEnd(); ++it)
+    {
+        keys << it.key();
+        items << it.value();
+    }
+    unmap();
+
+    QVector<int> order(keys.count());
+    for(int i=0; i<order.count(); ++i)
+    {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&keys](int a, int b) { return keys[a] < keys[b]; });
+
+    QByteArray records(order.count() * LIBRARY_RECORD_SIZE, 0), strings;
+    for(int i=0; i<order.count(); ++i)
+    {
+        const MusicSongLibraryItem &item = items[order[i]];
+        const QByteArray &data = (QStringList() << item.m_path << item.m_type << item.m_playTime << item.m_title << item.m_artist).join(QChar(0)).toUtf8();
+
+        uchar *record = TTKReinterpret_cast(uchar*, records.data()) + i * LIBRARY_RECORD_SIZE;
+        qToLittleEndian<quint64>(keys[order[i]], record);
+        qToLittleEndian<qint64>(item.m_size, record + 8);
+        qToLittleEndian<qint64>(item.m_modified, record + 16);
+        qToLittleEndian<quint32>(strings.size(), record + 24);
+        qToLittleEndian<quint32>(data.size(), record + 28);
+        strings.append(data);
+    }
+
+    uchar header[LIBRARY_HEADER_SIZE];
+    qToLittleEndian<quint32>(LIBRARY_MAGIC, header);
+    qToLittleEndian<quint32>(LIBRARY_VERSION, header + 4);
+    qToLittleEndian<quint32>(order.count(), header + 8);
+    qToLittleEndian<quint32>(LIBRARY_HEADER_SIZE + records.size(), header + 12);
+
+    QFile file(path);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    file.write(TTKReinterpret_cast(const char*, header), LIBRARY_HEADER_SIZE);
+    file.write(records);
+    file.write(strings);
+    file.close();
+
+    m_items.clear();
+    m_removed.clear();
+    return true;
+}
+
+bool MusicSongLibraryManager::find(const QString &path, MusicSongLibraryItem &item)
+{
+    const quint64 key = hashKey(path);
+    QMutexLocker locker(&m_mutex);
+    if(!lookup(key, path, item))
+    {
+        return false;
+    }
+
+    if(!m_validated.contains(key))
+    {
+        m_validated.insert(key);
+        m_pending << path;
+    }
+    return true;
+}
+
+void MusicSongLibraryManager::insert(const MusicSongLibraryItem &item)
+{
+    const quint64 key = hashKey(item.m_path);
+    QMutexLocker locker(&m_mutex);
+    m_items.insert(key, item);
+    m_removed.remove(key);
+    m_validated.insert(key);
+}
+
+void MusicSongLibraryManager::remove(const QString &path)
+{
+    const quint64 key = hashKey(path);
+    QMutexLocker locker(&m_mutex);
+    m_items.remove(key);
+    m_removed.insert(key);
+}
+
+bool MusicSongLibraryManager::stat(const QString &path, MusicSongLibraryItem &item)
+{
+    const QFileInfo info(path);
+    if(!info.exists())
+    {
+        return false;
+    }
+
+    item.m_path = path;
+    item.m_size = info.size();
+    item.m_type = info.suffix();
+    item.m_modified = info.lastModified().toMSecsSinceEpoch();
+    return true;
+}
+
+void MusicSongLibraryManager::revalidate()
+{
+    QMutexLocker locker(&m_mutex);
+    if(!m_pending.isEmpty() && !m_thread->isRunning())
+    {
+        m_thread->start();
+    }
+}
+
+bool MusicSongLibraryManager::takeRevalidateItem(MusicSongLibraryItem &item)
+{
+    QMutexLocker locker(&m_mutex);
+    while(!m_pending.isEmpty())
+    {
+        const QString &path = m_pending.takeFirst();
+        if(lookup(hashKey(path), path, item))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+quint64 MusicSongLibraryManager::hashKey(const QString &path)
+{
+    ///FNV-1a 64 bit
+    quint64 hash = Q_UINT64_C(14695981039346656037);
+    const ushort *data = path.utf16();
+    for(int i=0; i<path.length(); ++i)
+    {
+        hash ^= data[i];
+        hash *= Q_UINT64_C(1099511628211);
+    }
+    return hash;
+}
+
+bool MusicSongLibraryManager::lookup(quint64 key, const QString &path, MusicSongLibraryItem &item) const
+{
+    if(m_removed.contains(key))
+    {
+        return false;
+    }
+
+    auto it = m_items.constFind(key);
+    if(it != m_items.constEnd())
+    {
+        if(it.value().m_path != path)
+        {
+            return false;
+        }
+        item = it.value();
+        return true;
+    }
+    return findMapped(key, path, item);
+}
+
+bool MusicSongLibraryManager::findMapped(quint64 key, const QString &path, MusicSongLibraryItem &item) const
+{
+    int left = 0, right = m_mappedCount;
+    while(left < right)
+    {
+        const int middle = left + (right - left) / 2;
+        if(qFromLittleEndian<quint64>(m_mapped + LIBRARY_HEADER_SIZE + middle * LIBRARY_RECORD_SIZE) < key)
+        {
+            left = middle + 1;
+        }
+        else
+        {
+            right = middle;
+        }
+    }
+
+    for(; left < m_mappedCount; ++left)
+    {
+        if(qFromLittleEndian<quint64>(m_mapped + LIBRARY_HEADER_SIZE + left * LIBRARY_RECORD_SIZE) != key)
+        {
+            break;
+        }
+
+        const MusicSongLibraryItem &mapped = readMapped(left);
+        if(mapped.m_path == path)
+        {
+            item = mapped;
+            return true;
+        }
+    }
+    return false;
+}
+
+MusicSongLibraryItem MusicSongLibraryManager::readMapped(int index) const
+{
+    const uchar *record = m_mapped + LIBRARY_HEADER_SIZE + index * LIBRARY_RECORD_SIZE;
+    const quint32 base = LIBRARY_HEADER_SIZE + m_mappedCount * LIBRARY_RECORD_SIZE;
+    const quint32 offset = qFromLittleEndian<quint32>(record + 24);
+    const quint32 length = qFromLittleEndian<quint32>(record + 28);
+
+    MusicSongLibraryItem item;
+    if(base + offset + length > m_file.size())
+    {
+        return item;
+    }
+
+    const QStringList &fields = QString::fromUtf8(TTKReinterpret_cast(const char*, m_mapped + base + offset), length).split(QChar(0));
+    if(fields.count() != 5)
+    {
+        return item;
+    }
+
+    item.m_size = qFromLittleEndian<qint64>(record + 8);
+    item.m_modified = qFromLittleEndian<qint64>(record + 16);
+    item.m_path = fields[0];
+    item.m_type = fields[1];
+    item.m_playTime = fields[2];
+    item.m_title = fields[3];
+    item.m_artist = fields[4];
+    return item;
+}
+
+void MusicSongLibraryManager::unmap()
+{
+    if(m_mapped)
+    {
+        m_file.unmap(TTKConst_cast(uchar*, m_mapped));
+    }
+
+    m_mapped = nullptr;
+    m_mappedCount = 0;
+    m_file.close();
+}
@@ -0,0 +1,168 @@
+#ifndef MUSICSONGLIBRARYMANAGER_H
+#define MUSICSONGLIBRARYMANAGER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QSet>
+#include <QHash>
+#include <QFile>
+#include <QMutex>
+#include "ttksingleton.h"
+#include "musicobject.h"
+#include "musicabstractthread.h"
+
+/*! @brief The class of the music song library item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicSongLibraryItem
+{
+    qint64 m_size;
+    qint64 m_modified;
+    QString m_path;
+    QString m_type;
+    QString m_playTime;
+    QString m_title;
+    QString m_artist;
+
+    MusicSongLibraryItem()
+    {
+        m_size = 0;
+        m_modified = -1;
+    }
+
+    inline bool isValid() const
+    {
+        return m_modified >= 0;
+    }
+}MusicSongLibraryItem;
+
+
+/*! @brief The class of the music song library revalidate thread.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongLibraryThread : public MusicAbstractThread
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicSongLibraryThread)
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicSongLibraryThread(QObject *parent = nullptr);
+
+protected:
+    /*!
+     * Thread run now.
+     */
+    virtual void run() override;
+
+};
+
+
+/*! @brief The class of the music song library manager.
+ * Keeps file size, modified time, duration and tags of local songs in
+ * a binary index keyed by path hash, so that songs can be constructed
+ * without stat the file system. Entries are revalidated in background.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongLibraryManager
+{
+    TTK_DECLARE_MODULE(MusicSongLibraryManager)
+public:
+    /*!
+     * Load library index from file.
+     */
+    bool readLibrary(const QString &path = LIBRARYPATH_FULL);
+    /*!
+     * Save library index into file.
+     */
+    bool writeLibrary(const QString &path = LIBRARYPATH_FULL);
+
+    /*!
+     * Find library item by path, queue it for revalidation if found.
+     */
+    bool find(const QString &path, MusicSongLibraryItem &item);
+    /*!
+     * Insert or replace library item by path.
+     */
+    void insert(const MusicSongLibraryItem &item);
+    /*!
+     * Remove library item by path.
+     */
+    void remove(const QString &path);
+    /*!
+     * Stat file and build library item, return false if file is not exist.
+     */
+    static bool stat(const QString &path, MusicSongLibraryItem &item);
+
+    /*!
+     * Start revalidate the queued entries in background.
+     */
+    void revalidate();
+    /*!
+     * Take one queued item to revalidate, return false if empty.
+     */
+    bool takeRevalidateItem(MusicSongLibraryItem &item);
+
+    /*!
+     * Get path hash key.
+     */
+    static quint64 hashKey(const QString &path);
+
+protected:
+    /*!
+     * Object contsructor.
+     */
+    MusicSongLibraryManager();
+    ~MusicSongLibraryManager();
+
+    /*!
+     * Find item from memory or mapped file by key.
+     */
+    bool lookup(quint64 key, const QString &path, MusicSongLibraryItem &item) const;
+    /*!
+     * Find item from mapped file by key.
+     */
+    bool findMapped(quint64 key, const QString &path, MusicSongLibraryItem &item) const;
+    /*!
+     * Read mapped item by index.
+     */
+    MusicSongLibraryItem readMapped(int index) const;
+    /*!
+     * Release mapped file.
+     */
+    void unmap();
+
+    QMutex m_mutex;
+    QFile m_file;
+    const uchar *m_mapped;
+    int m_mappedCount;
+    QHash<quint64, MusicSongLibraryItem> m_items;
+    QSet<quint64> m_removed, m_validated;
+    QStringList m_pending;
+    MusicSongLibraryThread *m_thread;
+
+    DECLARE_SINGLETON_CLASS(MusicSongLibraryManager)
+
+};
+
+#define G_LIBRARY_PTR GetMusicSongLibraryManager()
+TTK_MODULE_EXPORT MusicSongLibraryManager* GetMusicSongLibraryManager();
+
+#endif // MUSICSONGLIBRARYMANAGER_H
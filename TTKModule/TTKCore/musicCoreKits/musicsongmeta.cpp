@@ -33,7 +33,7 @@ MusicSongMeta::~MusicSongMeta()
     clearSongMeta();
 }
 
-bool MusicSongMeta::read(const QString &file)
+bool MusicSongMeta::read(const QString &file, bool cover)
 {
     bool track = false;
     QString path(file);
@@ -54,7 +54,7 @@ bool MusicSongMeta::read(const QString &file)
     }
 
     m_path = path;
-    const bool status = readInformation();
+    const bool status = readInformation(cover);
     if(status && track)
     {
         setSongMetaIndex(file.section("#", -1).toInt() - 1);
@@ -332,18 +332,18 @@ QString MusicSongMeta::findLegalDataString(TagWrapper::Type type)
     return MusicUtils::String::illegalCharactersReplaced(v);
 }
 
-bool MusicSongMeta::readInformation()
+bool MusicSongMeta::readInformation(bool cover)
 {
     clearSongMeta();
     DecoderFactory *factory = Decoder::findByFilePath(m_path);
 
     if(factory)
     {
-        QPixmap cover;
-        MetaDataModel *model = factory->createMetaDataModel(m_path, true);
+        QPixmap pix;
+        MetaDataModel *model = cover ? factory->createMetaDataModel(m_path, true) : nullptr;
         if(model)
         {
-            cover = model->cover();
+            pix = model->cover();
             delete model;
         }
 
@@ -382,7 +382,7 @@ bool MusicSongMeta::readInformation()
 
         if(!m_songMetas.isEmpty())
         {
-            getSongMeta()->m_cover = cover;
+            getSongMeta()->m_cover = pix;
 
             if(length == 0)
             {
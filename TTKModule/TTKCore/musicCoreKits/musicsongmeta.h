@@ -38,9 +38,9 @@ public:
     ~MusicSongMeta();
 
     /*!
-     * Read music file to anaylsis.
+     * Read music file to anaylsis, skip cover decoding if cover is false.
      */
-    bool read(const QString &file);
+    bool read(const QString &file, bool cover = true);
     /*!
      * Save music tags to music file.
      */
@@ -184,7 +184,7 @@ protected:
     /*!
      * Read other taglib not by plugin.
      */
-    bool readInformation();
+    bool readInformation(bool cover);
     /*!
      * Save other taglib not by plugin.
      */
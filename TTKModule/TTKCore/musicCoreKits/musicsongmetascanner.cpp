@@ -0,0 +1,162 @@
+#include "musicsongmetascanner.h"
+#include "musicformats.h"
+
+#define SCAN_BATCH_SIZE     50
+
+MusicSongMetaScanRunnable::MusicSongMetaScanRunnable(MusicSongMetaScanner *scanner, int index, const QString &path)
+    : QRunnable()
+    , m_scanner(scanner)
+    , m_index(index)
+    , m_path(path)
+{
+    setAutoDelete(true);
+}
+
+void MusicSongMetaScanRunnable::run()
+{
+    if(m_scanner->isCanceled())
+    {
+        return;
+    }
+
+    m_scanner->setResult(m_index, MusicObject::generateMusicSongList(m_path));
+    QMetaObject::invokeMethod(m_scanner, "resultReady", Qt::QueuedConnection);
+}
+
+
+
+MusicSongMetaScanner::MusicSongMetaScanner(QObject *parent)
+    : QObject(parent)
+{
+    m_flushed = 0;
+    m_scanned = 0;
+    m_canceled = false;
+    m_running = false;
+}
+
+MusicSongMetaScanner::~MusicSongMetaScanner()
+{
+    cancel();
+}
+
+void MusicSongMetaScanner::start(const QStringList &files)
+{
+    cancel();
+
+    m_mutex.lock();
+    m_results = QVector<MusicSongs>(files.count());
+    m_ready = QVector<bool>(files.count(), false);
+    m_flushed = 0;
+    m_scanned = 0;
+    m_canceled = false;
+    m_running = true;
+    m_mutex.unlock();
+
+    if(files.isEmpty())
+    {
+        m_running = false;
+        Q_EMIT finished();
+        return;
+    }
+
+    ///load decoder factories in caller thread first
+    MusicFormats::supportFormats();
+    for(int i=0; i<files.count(); ++i)
+    {
+        m_pool.start(new MusicSongMetaScanRunnable(this, i, files[i]));
+    }
+}
+
+bool MusicSongMetaScanner::isRunning() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_running;
+}
+
+bool MusicSongMetaScanner::isCanceled() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_canceled;
+}
+
+void MusicSongMetaScanner::cancel()
+{
+    m_mutex.lock();
+    const bool running = m_running;
+    m_canceled = true;
+    m_running = false;
+    m_mutex.unlock();
+
+#if TTK_QT_VERSION_CHECK(5,2,0)
+    m_pool.clear();
+#endif
+    m_pool.waitForDone();
+
+    if(running)
+    {
+        Q_EMIT finished();
+    }
+}
+
+void MusicSongMetaScanner::resultReady()
+{
+    MusicSongs songs;
+    bool done = false;
+    int scanned = 0;
+
+    m_mutex.lock();
+    if(!m_running)
+    {
+        m_mutex.unlock();
+        return;
+    }
+
+    int flushed = m_flushed;
+    while(flushed < m_ready.count() && m_ready[flushed])
+    {
+        ++flushed;
+    }
+
+    done = (flushed == m_ready.count());
+    if(done || flushed - m_flushed >= SCAN_BATCH_SIZE)
+    {
+        for(int i=m_flushed; i<flushed; ++i)
+        {
+            songs << m_results[i];
+            m_results[i].clear();
+        }
+        m_flushed = flushed;
+    }
+
+    scanned = m_scanned;
+    if(done)
+    {
+        m_running = false;
+    }
+    m_mutex.unlock();
+
+    ///progress receivers may process events and flush a later batch, so songs go first
+    if(!songs.isEmpty())
+    {
+        Q_EMIT songsReady(songs);
+    }
+    Q_EMIT progressChanged(scanned);
+
+    if(done)
+    {
+        Q_EMIT finished();
+    }
+}
+
+void MusicSongMetaScanner::setResult(int index, const MusicSongs &songs)
+{
+    QMutexLocker locker(&m_mutex);
+    if(index < 0 || index >= m_results.count())
+    {
+        return;
+    }
+
+    m_results[index] = songs;
+    m_ready[index] = true;
+    ++m_scanned;
+}
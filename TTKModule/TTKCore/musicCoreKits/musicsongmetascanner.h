@@ -0,0 +1,123 @@
+#ifndef MUSICSONGMETASCANNER_H
+#define MUSICSONGMETASCANNER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QMutex>
+#include <QThreadPool>
+#include "musicsong.h"
+
+class MusicSongMetaScanner;
+
+/*! @brief The class of the music song meta scan runnable.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongMetaScanRunnable : public QRunnable
+{
+public:
+    /*!
+     * Object contsructor.
+     */
+    MusicSongMetaScanRunnable(MusicSongMetaScanner *scanner, int index, const QString &path);
+
+    /*!
+     * Runnable run now.
+     */
+    virtual void run() override;
+
+protected:
+    MusicSongMetaScanner *m_scanner;
+    int m_index;
+    QString m_path;
+
+};
+
+
+/*! @brief The class of the music song meta scanner.
+ * Reads song tags and length in a worker pool without cover decoding,
+ * results are emitted in batches with the same order as input files.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongMetaScanner : public QObject
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicSongMetaScanner)
+    friend class MusicSongMetaScanRunnable;
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicSongMetaScanner(QObject *parent = nullptr);
+    ~MusicSongMetaScanner();
+
+    /*!
+     * Start to scan files.
+     */
+    void start(const QStringList &files);
+    /*!
+     * Check scanner is running.
+     */
+    bool isRunning() const;
+    /*!
+     * Check scanner is canceled.
+     */
+    bool isCanceled() const;
+
+Q_SIGNALS:
+    /*!
+     * Scanned songs batch is ready.
+     */
+    void songsReady(const MusicSongs &songs);
+    /*!
+     * Scan progress changed.
+     */
+    void progressChanged(int value);
+    /*!
+     * Scan finished or canceled.
+     */
+    void finished();
+
+public Q_SLOTS:
+    /*!
+     * Cancel current scan.
+     */
+    void cancel();
+
+private Q_SLOTS:
+    /*!
+     * Flush ready results in order.
+     */
+    void resultReady();
+
+protected:
+    /*!
+     * Store scanned result by index.
+     */
+    void setResult(int index, const MusicSongs &songs);
+
+    mutable QMutex m_mutex;
+    QThreadPool m_pool;
+    QVector<MusicSongs> m_results;
+    QVector<bool> m_ready;
+    int m_flushed, m_scanned;
+    bool m_canceled, m_running;
+
+};
+
+#endif // MUSICSONGMETASCANNER_H
@@ -0,0 +1,132 @@
+#include "musicstartupmanager.h"
+
+#include <QFile>
+#include <QTimer>
+#include <QTextStream>
+
+MusicStartupManager::MusicStartupManager()
+    : QObject(nullptr)
+{
+    m_last = 0;
+    m_running = false;
+    m_pending = false;
+}
+
+void MusicStartupManager::start()
+{
+    m_traces.clear();
+    m_timer.start();
+    m_last = 0;
+}
+
+void MusicStartupManager::mark(const QString &stage)
+{
+    if(!m_timer.isValid())
+    {
+        return;
+    }
+
+    appendTrace(stage, m_last, false);
+}
+
+void MusicStartupManager::append(const QString &stage, QObject *object, const char *method)
+{
+    Stage item;
+    item.m_name = stage;
+    item.m_object = object;
+    item.m_method = method;
+    m_stages << item;
+
+    ///stages appended after the run started still go to the queue
+    if(m_running)
+    {
+        scheduleNextStage();
+    }
+}
+
+void MusicStartupManager::run()
+{
+    if(m_running)
+    {
+        return;
+    }
+
+    m_running = true;
+    scheduleNextStage();
+}
+
+void MusicStartupManager::runNextStage()
+{
+    m_pending = false;
+    if(m_stages.isEmpty())
+    {
+        if(m_timer.isValid())
+        {
+            writeTraces();
+            m_timer.invalidate();
+            Q_EMIT finished();
+        }
+        return;
+    }
+
+    const Stage stage = m_stages.takeFirst();
+    const qint64 start = m_timer.isValid() ? m_timer.elapsed() : 0;
+    if(stage.m_object)
+    {
+        QMetaObject::invokeMethod(stage.m_object, stage.m_method.constData());
+    }
+
+    if(m_timer.isValid())
+    {
+        appendTrace(stage.m_name, start, true);
+    }
+    ///give the event loop one turn to paint between stages
+    scheduleNextStage();
+}
+
+void MusicStartupManager::scheduleNextStage()
+{
+    ///only one chain of stages runs at a time
+    if(!m_pending)
+    {
+        m_pending = true;
+        QTimer::singleShot(0, this, SLOT(runNextStage()));
+    }
+}
+
+void MusicStartupManager::appendTrace(const QString &stage, qint64 start, bool deferred)
+{
+    MusicStartupTrace trace;
+    trace.m_stage = stage;
+    trace.m_total = m_timer.elapsed();
+    trace.m_elapsed = trace.m_total - start;
+    trace.m_deferred = deferred;
+    m_traces << trace;
+    m_last = trace.m_total;
+
+    TTK_LOGGER_INFO(QString("Startup stage %1%2 takes %3ms at %4ms").arg(stage).arg(deferred ? " (deferred)" : "")
+                                                                    .arg(trace.m_elapsed).arg(trace.m_total));
+}
+
+void MusicStartupManager::writeTraces() const
+{
+    const QString path = QString::fromLocal8Bit(qgetenv("TTK_STARTUP_TRACE"));
+    if(path.isEmpty())
+    {
+        return;
+    }
+
+    QFile file(path);
+    if(!file.open(QFile::WriteOnly | QFile::Truncate | QFile::Text))
+    {
+        TTK_LOGGER_ERROR("Startup trace file open error: " << path);
+        return;
+    }
+
+    ///one line per stage: name, critical or deferred, elapsed and total msecs
+    QTextStream out(&file);
+    for(const MusicStartupTrace &trace : qAsConst(m_traces))
+    {
+        out << trace.m_stage << '\t' << (trace.m_deferred ? "deferred" : "critical") << '\t' << trace.m_elapsed << '\t' << trace.m_total << '\n';
+    }
+}
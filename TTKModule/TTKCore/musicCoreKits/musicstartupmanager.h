@@ -0,0 +1,124 @@
+#ifndef MUSICSTARTUPMANAGER_H
+#define MUSICSTARTUPMANAGER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QPointer>
+#include <QElapsedTimer>
+#include "ttksingleton.h"
+#include "musicglobaldefine.h"
+
+/*! @brief The class of the startup stage trace item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicStartupTrace
+{
+    QString m_stage;
+    qint64 m_elapsed;
+    qint64 m_total;
+    bool m_deferred;
+}MusicStartupTrace;
+TTK_DECLARE_LISTS(MusicStartupTrace)
+
+/*! @brief The class of the startup stage manager.
+ * Startup is split into named stages, the critical ones are marked while
+ * they run before the main window is shown, the deferred ones are run one
+ * per event loop turn after it is shown. Every stage is timed and the trace
+ * is written into the file named by TTK_STARTUP_TRACE environment value.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicStartupManager : public QObject
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicStartupManager)
+public:
+    /*!
+     * Start startup timing.
+     */
+    void start();
+    /*!
+     * Mark critical stage finished by name.
+     */
+    void mark(const QString &stage);
+    /*!
+     * Append deferred stage which invokes the object slot by name.
+     */
+    void append(const QString &stage, QObject *object, const char *method);
+    /*!
+     * Run deferred stages after the main window is shown.
+     */
+    void run();
+
+    /*!
+     * Get startup stage traces.
+     */
+    inline const MusicStartupTraces& getTraces() const { return m_traces; }
+
+Q_SIGNALS:
+    /*!
+     * All deferred stages finished.
+     */
+    void finished();
+
+private Q_SLOTS:
+    /*!
+     * Run next deferred stage.
+     */
+    void runNextStage();
+
+protected:
+    /*!
+     * Object contsructor.
+     */
+    MusicStartupManager();
+
+    /*!
+     * Append stage trace.
+     */
+    void appendTrace(const QString &stage, qint64 start, bool deferred);
+    /*!
+     * Queue the next stage call unless one is pending.
+     */
+    void scheduleNextStage();
+    /*!
+     * Write stage traces into trace file.
+     */
+    void writeTraces() const;
+
+    typedef struct Stage
+    {
+        QString m_name;
+        QPointer<QObject> m_object;
+        QByteArray m_method;
+    }Stage;
+
+    QElapsedTimer m_timer;
+    qint64 m_last;
+    bool m_running, m_pending;
+    QList<Stage> m_stages;
+    MusicStartupTraces m_traces;
+
+    DECLARE_SINGLETON_CLASS(MusicStartupManager)
+
+};
+
+#define G_STARTUP_PTR GetMusicStartupManager()
+TTK_MODULE_EXPORT MusicStartupManager* GetMusicStartupManager();
+
+#endif // MUSICSTARTUPMANAGER_H
@@ -2,7 +2,6 @@
 #ifndef MUSIC_MOBILE
 #include "musiclrcfromkrc.h"
 #endif
-#include <qmath.h>
 #include "musicstringutils.h"
 #include "musicapplication.h"
 #include "musicdownloadqueryfactory.h"
@@ -12,6 +11,8 @@ MusicLrcAnalysis::MusicLrcAnalysis(QObject *parent)
     : QObject(parent)
 {
     m_lineMax = 0;
+    m_lrcOffset = 0;
+    m_lrcCursor = 0;
     m_currentLrcIndex = 0;
     m_networkRequest = nullptr;
 }
@@ -25,7 +26,9 @@ MusicLrcAnalysis::State MusicLrcAnalysis::setLrcData(const QByteArray &data)
 {
     m_currentLrcIndex = 0;
     m_lrcContainer.clear();
+    m_lrcWords.clear();
     m_currentShowLrcContainer.clear();
+    updateLrcTimeline();
 
     QStringList getAllText = QString(data).split("\n");
     if(data.left(9) == MUSIC_TTKLRCF) //plain txt check
@@ -39,10 +42,12 @@ MusicLrcAnalysis::State MusicLrcAnalysis::setLrcData(const QByteArray &data)
     }
     else
     {
+        m_lrcOffset = 0;
         for(const QString &oneLine : qAsConst(getAllText))
         {
             matchLrcLine(oneLine);
         }
+        applyLrcOffset();
     }
 
     if(m_lrcContainer.isEmpty())
@@ -60,12 +65,8 @@ MusicLrcAnalysis::State MusicLrcAnalysis::setLrcData(const QByteArray &data)
         m_lrcContainer.insert(0, QString());
     }
 
-    TTKIntStringMapIterator it(m_lrcContainer);
-    while(it.hasNext())
-    {
-        it.next();
-        m_currentShowLrcContainer << it.value();
-    }
+    updateLrcTimeline();
+    m_currentShowLrcContainer << m_lrcLines;
 
     for(int i=0; i<getMiddle(); ++i)
     {
@@ -83,6 +84,7 @@ MusicLrcAnalysis::State MusicLrcAnalysis::setLrcData(const TTKIntStringMap &data
     }
 
     m_lrcContainer = data;
+    m_lrcWords.clear();
     m_currentLrcIndex = 0;
     m_currentShowLrcContainer.clear();
 
@@ -96,12 +98,8 @@ MusicLrcAnalysis::State MusicLrcAnalysis::setLrcData(const TTKIntStringMap &data
         m_lrcContainer.insert(0, QString());
     }
 
-    TTKIntStringMapIterator it(m_lrcContainer);
-    while(it.hasNext())
-    {
-        it.next();
-        m_currentShowLrcContainer << it.value();
-    }
+    updateLrcTimeline();
+    m_currentShowLrcContainer << m_lrcLines;
 
     for(int i=0; i<getMiddle(); ++i)
     {
@@ -130,7 +128,9 @@ MusicLrcAnalysis::State MusicLrcAnalysis::readFromKrcFile(const QString &fileNam
 {
 #ifndef MUSIC_MOBILE
     m_lrcContainer.clear();
+    m_lrcWords.clear();
     m_currentShowLrcContainer.clear();
+    updateLrcTimeline();
     m_currentLrcIndex = 0;
     m_currentLrcFileName = fileName;
 
@@ -142,10 +142,14 @@ MusicLrcAnalysis::State MusicLrcAnalysis::readFromKrcFile(const QString &fileNam
 
     const QString &getAllText = QString(krc.getDecodeString());
     //The lyrics by line into the lyrics list
+    m_lrcOffset = 0;
     for(const QString &oneLine : getAllText.split(MusicUtils::String::newlines()))
     {
         matchLrcLine(oneLine);
     }
+    ///word times are keyed by line time, so they are shifted together with lines
+    m_lrcWords = krc.getWordTimes();
+    applyLrcOffset();
 
     //If the lrcContainer is empty
     if(m_lrcContainer.isEmpty())
@@ -163,12 +167,8 @@ MusicLrcAnalysis::State MusicLrcAnalysis::readFromKrcFile(const QString &fileNam
        m_lrcContainer.insert(0, QString());
     }
 
-    TTKIntStringMapIterator it(m_lrcContainer);
-    while(it.hasNext())
-    {
-        it.next();
-        m_currentShowLrcContainer << it.value();
-    }
+    updateLrcTimeline();
+    m_currentShowLrcContainer << m_lrcLines;
     for(int i=0; i<getMiddle(); ++i)
     {
         m_currentShowLrcContainer << QString();
@@ -183,245 +183,201 @@ MusicLrcAnalysis::State MusicLrcAnalysis::readFromKrcFile(const QString &fileNam
 
 void MusicLrcAnalysis::matchLrcLine(const QString &oneLine)
 {
-    const QRegExp regx01("\\[\\d{2}:\\d{2}\\.\\d{3}\\]");
-    const QRegExp regx02("\\[\\d{2}:\\d{2}\\.\\d{2}\\]");
-    const QRegExp regx03("\\[\\d{2}:\\d{2}\\.\\d{1}\\]");
-    const QRegExp regx04("\\[\\d{2}:\\d{2}:\\d{3}\\]");
-    const QRegExp regx05("\\[\\d{2}:\\d{2}:\\d{2}\\]");
-    const QRegExp regx06("\\[\\d{2}:\\d{2}:\\d{1}\\]");
-    const QRegExp regx07("\\[\\d{2}:\\d{2}\\]");
-    const QRegExp regx08("\\[\\d{2}\\.\\d{2}\\.\\d{3}\\]");
-    const QRegExp regx09("\\[\\d{2}\\.\\d{2}\\.\\d{2}\\]");
-    const QRegExp regx10("\\[\\d{2}\\.\\d{2}\\.\\d{1}\\]");
-    const QRegExp regx11("\\[\\d{2}\\.\\d{2}:\\d{3}\\]");
-    const QRegExp regx12("\\[\\d{2}\\.\\d{2}:\\d{2}\\]");
-    const QRegExp regx13("\\[\\d{2}\\.\\d{2}:\\d{1}\\]");
-    const QRegExp regx14("\\[\\d{2}\\.\\d{2}\\]");
+    const QChar *data = oneLine.constData();
+    const int length = oneLine.length();
 
-    LrcFormat type = Type02;
-    QRegExp regx;
-    if(oneLine.contains(regx01))
-    {
-        type = Type01;
-        regx = regx01;
-    }
-    else if(oneLine.contains(regx02))
-    {
-        type = Type02;
-        regx = regx02;
-    }
-    else if(oneLine.contains(regx03))
+    QList<qint64> times;
+    QString text;
+    int last = 0;
+    for(int i=0; i<length; ++i)
     {
-        type = Type03;
-        regx = regx03;
+        if(data[i] != QLatin1Char('['))
+        {
+            continue;
+        }
+
+        int end = i;
+        qint64 time = 0;
+        if(matchLrcTime(data, length, end, time))
+        {
+            times << time;
+        }
+        else if(!matchLrcOffset(data, length, end))
+        {
+            continue;
+        }
+
+        text += oneLine.midRef(last, i - last);
+        last = end;
+        i = end - 1;
     }
-    else if(oneLine.contains(regx04))
+
+    if(times.isEmpty())
     {
-        type = Type04;
-        regx = regx04;
+        return;
     }
-    else if(oneLine.contains(regx05))
+
+    text += oneLine.midRef(last);
+    for(const qint64 time : qAsConst(times))
     {
-        type = Type05;
-        regx = regx05;
+        m_lrcContainer.insert(time, text);
     }
-    else if(oneLine.contains(regx06))
+}
+
+static inline bool isLrcDigit(const QChar &c)
+{
+    return c.unicode() >= '0' && c.unicode() <= '9';
+}
+
+static inline bool isLrcSeparator(const QChar &c)
+{
+    return c.unicode() == ':' || c.unicode() == '.';
+}
+
+bool MusicLrcAnalysis::matchLrcTime(const QChar *data, int length, int &pos, qint64 &time) const
+{
+    ///shortest tag is [xx:xx]
+    int i = pos + 1;
+    if(i + 6 > length || !isLrcDigit(data[i]) || !isLrcDigit(data[i + 1]) || !isLrcSeparator(data[i + 2]) ||
+                         !isLrcDigit(data[i + 3]) || !isLrcDigit(data[i + 4]))
     {
-        type = Type06;
-        regx = regx06;
+        return false;
     }
-    else if(oneLine.contains(regx07))
+
+    const int minutes = (data[i].unicode() - '0') * 10 + (data[i + 1].unicode() - '0');
+    const int seconds = (data[i + 3].unicode() - '0') * 10 + (data[i + 4].unicode() - '0');
+    int milliseconds = 0;
+    i += 5;
+
+    if(isLrcSeparator(data[i]))
     {
-        type = Type07;
-        regx = regx07;
+        int count = 0;
+        for(++i; i < length && count < 3 && isLrcDigit(data[i]); ++i, ++count)
+        {
+            milliseconds = milliseconds * 10 + (data[i].unicode() - '0');
+        }
+
+        if(count == 0)
+        {
+            return false;
+        }
+
+        for(; count < 3; ++count)
+        {
+            milliseconds *= 10;
+        }
     }
-    else if(oneLine.contains(regx08))
+
+    if(i >= length || data[i] != QLatin1Char(']'))
     {
-        type = Type08;
-        regx = regx08;
+        return false;
     }
-    else if(oneLine.contains(regx09))
+
+    time = minutes * MT_M2MS + seconds * MT_S2MS + milliseconds;
+    pos = i + 1;
+    return true;
+}
+
+bool MusicLrcAnalysis::matchLrcOffset(const QChar *data, int length, int &pos)
+{
+    ///[offset:+/-xxx]
+    const char *tag = "[offset:";
+    int i = pos;
+    for(; *tag != 0; ++tag, ++i)
     {
-        type = Type09;
-        regx = regx09;
+        if(i >= length || data[i].toLower() != QLatin1Char(*tag))
+        {
+            return false;
+        }
     }
-    else if(oneLine.contains(regx10))
+
+    bool negative = false;
+    if(i < length && (data[i] == QLatin1Char('+') || data[i] == QLatin1Char('-')))
     {
-        type = Type10;
-        regx = regx10;
+        negative = data[i++] == QLatin1Char('-');
     }
-    else if(oneLine.contains(regx11))
+
+    qint64 offset = 0;
+    const int begin = i;
+    for(; i < length && isLrcDigit(data[i]); ++i)
     {
-        type = Type11;
-        regx = regx11;
+        offset = offset * 10 + (data[i].unicode() - '0');
     }
-    else if(oneLine.contains(regx12))
+
+    if(i == begin || i >= length || data[i] != QLatin1Char(']'))
     {
-        type = Type12;
-        regx = regx12;
+        return false;
     }
-    else if(oneLine.contains(regx13))
+
+    m_lrcOffset = negative ? -offset : offset;
+    pos = i + 1;
+    return true;
+}
+
+void MusicLrcAnalysis::applyLrcOffset()
+{
+    if(m_lrcOffset == 0)
     {
-        type = Type13;
-        regx = regx13;
+        return;
     }
-    else
+
+    ///positive offset shows lyrics sooner
+    TTKIntStringMap copy;
+    TTKIntStringMapIterator it(m_lrcContainer);
+    while(it.hasNext())
     {
-        type = Type14;
-        regx = regx14;
+        it.next();
+        copy.insert(qMax(it.key() - m_lrcOffset, qint64(0)), it.value());
     }
+    m_lrcContainer = copy;
 
-    QString temp = oneLine;
-    temp.replace(regx, QString());
-    int pos = regx.indexIn(oneLine, 0);
-    while(pos != -1)
+    QMap<qint64, MusicLrcWordTimes> words;
+    for(auto iter = m_lrcWords.constBegin(); iter != m_lrcWords.constEnd(); ++iter)
     {
-        const QString &cap = regx.cap(0);
-        //Return zeroth expression matching the content
-        //The time tag into the time value, in milliseconds
-        switch(type)
-        {
-            case Type01:
-                    matchLrcLine(temp, cap, "\\d{2}(?=:)", "\\d{2}(?=\\.)", "\\d{3}(?=\\])");
-                    break;
-            case Type02:
-                    matchLrcLine(temp, cap, "\\d{2}(?=:)", "\\d{2}(?=\\.)", "\\d{2}(?=\\])");
-                    break;
-            case Type03:
-                    matchLrcLine(temp, cap, "\\d{2}(?=:)", "\\d{2}(?=\\.)", "\\d{1}(?=\\])");
-                    break;
-            case Type04:
-                    matchLrcLine(temp, cap, ":");
-                    break;
-            case Type05:
-                    matchLrcLine(temp, cap, ":");
-                    break;
-            case Type06:
-                    matchLrcLine(temp, cap, ":");
-                    break;
-            case Type07:
-                    matchLrcLine(temp, cap, "\\d{2}(?=:)", "\\d{2}(?=\\])");
-                    break;
-            case Type08:
-                    matchLrcLine(temp, cap, ".");
-                    break;
-            case Type09:
-                    matchLrcLine(temp, cap, ".");
-                    break;
-            case Type10:
-                    matchLrcLine(temp, cap, ".");
-                    break;
-            case Type11:
-                    matchLrcLine(temp, cap, "\\d{2}(?=\\.)", "\\d{2}(?=:)", "\\d{3}(?=\\])");
-                    break;
-            case Type12:
-                    matchLrcLine(temp, cap, "\\d{2}(?=\\.)", "\\d{2}(?=:)", "\\d{2}(?=\\])");
-                    break;
-            case Type13:
-                    matchLrcLine(temp, cap, "\\d{2}(?=\\.)", "\\d{2}(?=:)", "\\d{1}(?=\\])");
-                    break;
-            case Type14:
-                    matchLrcLine(temp, cap, "\\d{2}(?=\\.)", "\\d{2}(?=\\])");
-                    break;
-            default: break;
-        }
-        pos += regx.matchedLength();
-        pos = regx.indexIn(oneLine, pos); //Matching all
+        words.insert(qMax(iter.key() - m_lrcOffset, qint64(0)), iter.value());
     }
+    m_lrcWords = words;
+    m_lrcOffset = 0;
 }
 
-void MusicLrcAnalysis::matchLrcLine(const QString &oneLine, const QString &cap, const QString &first, const QString &second, const QString &third)
-{
-    QRegExp regx;
-    regx.setPattern(first);
-    regx.indexIn(cap);
-
-    const int minutes = regx.cap(0).toInt();
-    regx.setPattern(second);
-    regx.indexIn(cap);
-
-    const int seconds = regx.cap(0).toInt();
-    regx.setPattern(third);
-    regx.indexIn(cap);
-
-    const int milliseconds = regx.cap(0).toInt();
-    const int length = QString::number(milliseconds).length();
-    const qint64 totalTime = minutes * MT_M2MS + seconds * MT_S2MS + milliseconds * pow(10, 3 - length);
-    m_lrcContainer.insert(totalTime, oneLine);
-}
-
-void MusicLrcAnalysis::matchLrcLine(const QString &oneLine, const QString &cap, const QString &first, const QString &second)
+void MusicLrcAnalysis::updateLrcTimeline()
 {
-    QRegExp regx;
-    regx.setPattern(first);
-    regx.indexIn(cap);
-
-    const int minutes = regx.cap(0).toInt();
-    regx.setPattern(second);
-    regx.indexIn(cap);
-
-    const int seconds = regx.cap(0).toInt();
-    const qint64 totalTime = minutes * MT_M2MS + seconds * MT_S2MS;
-    m_lrcContainer.insert(totalTime, oneLine);
-}
+    m_lrcCursor = 0;
+    m_lrcTimes.clear();
+    m_lrcLines.clear();
+    m_lrcTimes.reserve(m_lrcContainer.count());
+    m_lrcLines.reserve(m_lrcContainer.count());
 
-void MusicLrcAnalysis::matchLrcLine(const QString &oneLine, QString cap, const QString &splite)
-{
-    cap.chop(1);
-    cap.remove(0, 1);
-    const QStringList lists(cap.split(splite));
-    if(lists.count() != 3)
+    TTKIntStringMapIterator it(m_lrcContainer);
+    while(it.hasNext())
     {
-        return;
+        it.next();
+        m_lrcTimes << it.key();
+        m_lrcLines << it.value();
     }
-
-    const int minutes = lists[0].toInt();
-    const int seconds = lists[1].toInt();
-    const int milliseconds = lists[2].toInt();
-    const int length = QString::number(milliseconds).length();
-    const qint64 totalTime = minutes * MT_M2MS + seconds * MT_S2MS + milliseconds * pow(10, 3 - length);
-    m_lrcContainer.insert(totalTime, oneLine);
 }
 
 qint64 MusicLrcAnalysis::setSongSpeedChanged(qint64 time)
 {
-    const QList<qint64> keys(m_lrcContainer.keys());
-    qint64 beforeTime = 0;
-    int index = -1;
+    const int count = m_lrcTimes.count();
+    int index = count - 1;
 
-    if(!keys.isEmpty())
-    {
-        index = 0;
-        beforeTime = keys[0];
-    }
-    for(int i=1; i<keys.count(); ++i)
+    if(count > 1)
     {
-        index = i;
-        const qint64 afterTime = keys[i];
-        if(beforeTime <= time && time <= afterTime)
+        ///find the first line which starts at or after time
+        const int i = std::lower_bound(m_lrcTimes.constBegin() + 1, m_lrcTimes.constEnd(), time) - m_lrcTimes.constBegin();
+        if(i < count && m_lrcTimes[i - 1] <= time)
         {
-            time = afterTime;
-            break;
+            index = i;
+            time = m_lrcTimes[i];
         }
-        beforeTime = afterTime;
+        m_lrcCursor = index;
     }
 
     if((m_currentLrcIndex = index - 1) < 0)
     {
         m_currentLrcIndex = 0;
     }
-
-//    for(int i=0; i<m_currentShowLrcContainer.count(); ++i)
-//    {
-//        if(m_currentShowLrcContainer[i] == m_lrcContainer.value(time))
-//        {
-//            if((m_currentLrcIndex = i - getMiddle() - 1) < 0)
-//            {
-//                m_currentLrcIndex = 0;
-//            }
-//            break;
-//        }
-//    }
     return time;
 }
 
@@ -435,6 +391,14 @@ void MusicLrcAnalysis::revertLrcTime(qint64 pos)
         copy.insert(it.key() + pos, it.value());
     }
     m_lrcContainer = copy;
+
+    QMap<qint64, MusicLrcWordTimes> words;
+    for(auto iter = m_lrcWords.constBegin(); iter != m_lrcWords.constEnd(); ++iter)
+    {
+        words.insert(iter.key() + pos, iter.value());
+    }
+    m_lrcWords = words;
+    updateLrcTimeline();
 }
 
 void MusicLrcAnalysis::saveLrcData()
@@ -507,47 +471,52 @@ bool MusicLrcAnalysis::findText(qint64 current, qint64 total, QString &pre, QStr
     }
 
     //After get the current time in the lyrics of the two time points
-    qint64 previous = 0;
-    qint64 later = 0;
-    //Keys () method returns a list of lrcContainer
-    for(const qint64 value : m_lrcContainer.keys())
-    {
-        if(current >= value)
-        {
-            previous = value;
-        }
-        else
-        {
-            later = value;
-            break;
-        }
-    }
+    const int index = findIndex(current);
+    const qint64 previous = index < 0 ? 0 : m_lrcTimes[index];
+    qint64 later = index + 1 < m_lrcTimes.count() ? m_lrcTimes[index + 1] : 0;
     //To the last line, set the later to song total time value
     if(later == 0)
     {
         later = total;
+        last = m_lrcContainer.value(later);
+    }
+    else
+    {
+        last = m_lrcLines[index + 1];
     }
     //The lyrics content corresponds to obtain the current time
-    pre = m_lrcContainer.value(previous);
-    last = m_lrcContainer.value(later);
+    pre = index < 0 ? m_lrcContainer.value(previous) : m_lrcLines[index];
     interval = later - previous;
 
     return true;
 }
 
-qint64 MusicLrcAnalysis::findTime(int index) const
+int MusicLrcAnalysis::findIndex(qint64 time) const
 {
-    if(index + m_lineMax < m_currentShowLrcContainer.count())
+    const int count = m_lrcTimes.count();
+    if(count == 0 || time < m_lrcTimes[0])
+    {
+        return -1;
+    }
+
+    ///playback moves forward line by line, so check cached and next line first
+    for(int i=m_lrcCursor; i<=m_lrcCursor + 1 && i<count; ++i)
     {
-        TTKIntStringMapIterator it(m_lrcContainer);
-        for(int i=0; i<index + 1; ++i)
+        if(i >= 0 && m_lrcTimes[i] <= time && (i + 1 == count || time < m_lrcTimes[i + 1]))
         {
-            if(it.hasNext())
-            {
-                it.next();
-            }
+            return m_lrcCursor = i;
         }
-        return it.key();
+    }
+
+    m_lrcCursor = std::upper_bound(m_lrcTimes.constBegin(), m_lrcTimes.constEnd(), time) - m_lrcTimes.constBegin() - 1;
+    return m_lrcCursor;
+}
+
+qint64 MusicLrcAnalysis::findTime(int index) const
+{
+    if(index + m_lineMax < m_currentShowLrcContainer.count() && !m_lrcTimes.isEmpty())
+    {
+        return m_lrcTimes[qBound(0, index, m_lrcTimes.count() - 1)];
     }
     else
     {
@@ -573,9 +542,24 @@ qint64 MusicLrcAnalysis::findTime(const QStringList &ts) const
     return -1;
 }
 
+qint64 MusicLrcAnalysis::getTime(int index) const
+{
+    return (index < 0 || index >= m_lrcTimes.count()) ? -1 : m_lrcTimes[index];
+}
+
+QString MusicLrcAnalysis::getLine(int index) const
+{
+    return (index < 0 || index >= m_lrcLines.count()) ? QString() : m_lrcLines[index];
+}
+
+MusicLrcWordTimes MusicLrcAnalysis::getWordTimes(int index) const
+{
+    return (index < 0 || index >= m_lrcTimes.count()) ? MusicLrcWordTimes() : m_lrcWords.value(m_lrcTimes[index]);
+}
+
 QStringList MusicLrcAnalysis::getAllLrcList() const
 {
-    return m_lrcContainer.values();
+    return m_lrcLines;
 }
 
 QString MusicLrcAnalysis::getAllLrcString() const
@@ -27,6 +27,24 @@
 
 class MusicTranslationRequest;
 
+/*! @brief The class of the lrc word time item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicLrcWordTime
+{
+    qint64 m_start;
+    qint64 m_duration;
+    int m_length;
+
+    MusicLrcWordTime()
+    {
+        m_start = 0;
+        m_duration = -1;
+        m_length = 0;
+    }
+}MusicLrcWordTime;
+TTK_DECLARE_LISTS(MusicLrcWordTime)
+
 /*! @brief The class of the core lrc analysis.
  * @author Greedysky <greedysky@163.com>
  */
@@ -41,24 +59,6 @@ public:
         OpenFileFail        /*!< open file failed*/
     };
 
-    enum LrcFormat
-    {
-        Type01, /*!< [xx:xx.xxx]*/
-        Type02, /*!< [xx:xx.xx]*/
-        Type03, /*!< [xx:xx.x]*/
-        Type04, /*!< [xx:xx:xxx]*/
-        Type05, /*!< [xx:xx:xx]*/
-        Type06, /*!< [xx:xx:x]*/
-        Type07, /*!< [xx:xx]*/
-        Type08, /*!< [xx.xx.xxx]*/
-        Type09, /*!< [xx.xx.xx]*/
-        Type10, /*!< [xx.xx.x]*/
-        Type11, /*!< [xx.xx:xxx]*/
-        Type12, /*!< [xx.xx:xx]*/
-        Type13, /*!< [xx.xx:x]*/
-        Type14  /*!< [xx.xx]*/
-    };
-
     /*!
      * Object contsructor.
      */
@@ -155,6 +155,22 @@ public:
      * Get current time by texts.
      */
     qint64 findTime(const QStringList &ts) const;
+    /*!
+     * Get timeline index of the line which is showing at given time, -1 if none.
+     */
+    int findIndex(qint64 time) const;
+    /*!
+     * Get lrc time by timeline index.
+     */
+    qint64 getTime(int index) const;
+    /*!
+     * Get lrc text by timeline index.
+     */
+    QString getLine(int index) const;
+    /*!
+     * Get lrc word times by timeline index, empty if the line has no word timing.
+     */
+    MusicLrcWordTimes getWordTimes(int index) const;
 
     /*!
      * Get all lrcs from container.
@@ -173,26 +189,34 @@ public Q_SLOTS:
 
 protected:
     /*!
-     * Lrc analysis by match lrc line base.
+     * Lrc analysis by match lrc line base, all time tags of line are read in one pass.
      */
     void matchLrcLine(const QString &oneLine);
     /*!
-     * Lrc analysis by match lrc line two[xx.(:)xx].
+     * Lrc analysis by match time tag at pos, all of the lrc format is supported.
+     */
+    bool matchLrcTime(const QChar *data, int length, int &pos, qint64 &time) const;
+    /*!
+     * Lrc analysis by match offset tag at pos.
      */
-    void matchLrcLine(const QString &oneLine, const QString &cap, const QString &first, const QString &second);
+    bool matchLrcOffset(const QChar *data, int length, int &pos);
     /*!
-     * Lrc analysis by match lrc line three[xx.xx.x(xx)]\[xx:xx:x(xx)].
+     * Apply offset tag to all lrc and word times.
      */
-    void matchLrcLine(const QString &oneLine, QString cap, const QString &splite);
+    void applyLrcOffset();
     /*!
-     * Lrc analysis by match lrc line three[xx.(:)xx.(:)x(xx)].
+     * Rebuild the sorted timeline from lrc container.
      */
-    void matchLrcLine(const QString &oneLine, const QString &cap, const QString &first, const QString &second, const QString &third);
+    void updateLrcTimeline();
 
     int m_lineMax, m_currentLrcIndex;
+    mutable int m_lrcCursor;
+    qint64 m_lrcOffset;
     QString m_currentLrcFileName;
     TTKIntStringMap m_lrcContainer;
-    QStringList m_currentShowLrcContainer;
+    QVector<qint64> m_lrcTimes;
+    QMap<qint64, MusicLrcWordTimes> m_lrcWords;
+    QStringList m_lrcLines, m_currentShowLrcContainer;
     MusicTranslationRequest *m_networkRequest;
 
 };
@@ -99,6 +99,11 @@ QByteArray MusicLrcFromKrc::getDecodeString() const
     return m_data;
 }
 
+QMap<qint64, MusicLrcWordTimes> MusicLrcFromKrc::getWordTimes() const
+{
+    return m_words;
+}
+
 int MusicLrcFromKrc::sncasecmp(char *s1, char *s2, size_t n)
 {
     uint c1, c2;
@@ -170,7 +175,12 @@ int MusicLrcFromKrc::isfilter(char *tok)
 void MusicLrcFromKrc::createLrc(uchar *lrc, int lrclen)
 {
     m_data.clear();
+    m_words.clear();
+
     int top = 0;
+    qint64 line = -1;
+    QByteArray word;
+    MusicLrcWordTime time;
     for(int i = 0; i<lrclen; i++)
     {
         int len;
@@ -179,9 +189,21 @@ void MusicLrcFromKrc::createLrc(uchar *lrc, int lrclen)
             switch(lrc[i])
             {
                 case '<':
+                {
+                    ///word tag <start,duration,0> relative to line start
+                    createWord(line, time, word);
+                    int start = 0, duration = 0;
+                    if(sscanf((char*)&lrc[i], "<%d,%d", &start, &duration) == 2)
+                    {
+                        time.m_start = start;
+                        time.m_duration = duration;
+                    }
                     top++;
                     break;
+                }
                 case '[':
+                    createWord(line, time, word);
+                    line = -1;
                     len = (strchr((char*)&lrc[i], ']') - (char*)&lrc[i]) + 1;
                     for(int j = 0; j<len; j++)
                     {
@@ -206,12 +228,9 @@ void MusicLrcFromKrc::createLrc(uchar *lrc, int lrclen)
                             char ftime[14];
                             lrc[i + j] = 0;
                             ms = atoi((char*)&lrc[i + 1]);
-                            sprintf(ftime, "[%.2d:%.2d.%.2d]", (ms % MT_H2MS) / MT_M2MS, (ms % MT_M2MS) / MT_S2MS, (ms % MT_M2MS) % 100);
-
-                            for(j = 0; j < 10; j++)
-                            {
-                                m_data.append(ftime[j]);
-                            }
+                            line = ms % MT_H2MS;
+                            sprintf(ftime, "[%.2d:%.2d.%.3d]", (ms % MT_H2MS) / MT_M2MS, (ms % MT_M2MS) / MT_S2MS, ms % MT_S2MS);
+                            m_data.append(ftime);
                             i = i + len - 1;
                             break;
                         }
@@ -220,6 +239,14 @@ void MusicLrcFromKrc::createLrc(uchar *lrc, int lrclen)
         filter_done:
                 default:
                     m_data.append(lrc[i]);
+                    if(lrc[i] == '\r' || lrc[i] == '\n')
+                    {
+                        createWord(line, time, word);
+                    }
+                    else if(time.m_duration >= 0)
+                    {
+                        word.append(lrc[i]);
+                    }
                     break;
             }
 
@@ -229,4 +256,17 @@ void MusicLrcFromKrc::createLrc(uchar *lrc, int lrclen)
             top--;
         }
     }
+    createWord(line, time, word);
+}
+
+void MusicLrcFromKrc::createWord(qint64 line, MusicLrcWordTime &time, QByteArray &word)
+{
+    if(line >= 0 && time.m_duration >= 0)
+    {
+        time.m_length = QString::fromUtf8(word).length();
+        m_words[line] << time;
+    }
+
+    time = MusicLrcWordTime();
+    word.clear();
 }
@@ -19,7 +19,7 @@
  * with this program; If not, see <http://www.gnu.org/licenses/>.
  ================================================= */
 
-#include "musicglobaldefine.h"
+#include "musiclrcanalysis.h"
 
 /*! @brief The class of the krc to lrc.
  * @author Greedysky <greedysky@163.com>
@@ -42,6 +42,10 @@ public:
      * Get decode string.
      */
     QByteArray getDecodeString() const;
+    /*!
+     * Get word times of decoded lines, keyed by line start time.
+     */
+    QMap<qint64, MusicLrcWordTimes> getWordTimes() const;
 
 protected:
     /*!
@@ -60,9 +64,14 @@ protected:
      * Create lrc by input data and length.
      */
     void createLrc(uchar *lrc, int lrclen);
+    /*!
+     * Append the pending word time to line and reset it.
+     */
+    void createWord(qint64 line, MusicLrcWordTime &time, QByteArray &word);
 
     uchar *m_resultBytes;
     QByteArray m_data;
+    QMap<qint64, MusicLrcWordTimes> m_words;
 
 };
 
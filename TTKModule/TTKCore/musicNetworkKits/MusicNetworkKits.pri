@@ -29,6 +29,9 @@ INCLUDEPATH += $$PWD \
 
 HEADERS  += \
     $$PWD/common/musicnetworkthread.h \
+    $$PWD/common/musicnetworkcache.h \
+    $$PWD/common/musicnetworksession.h \
+    $$PWD/common/musicurlsizeprobe.h \
     $$PWD/common/musicnetworkproxy.h \
     $$PWD/common/musicnetworkoperator.h \
     $$PWD/common/musicdownloaddatarequest.h \
@@ -37,6 +40,7 @@ HEADERS  += \
     $$PWD/common/musicdownloadsourcerequest.h \
     $$PWD/common/musicdownloadbackgroundrequest.h \
     $$PWD/common/musicdownloadqueuerequest.h \
+    $$PWD/common/musicsongprefetcher.h \
     $$PWD/common/musicidentifysongsrequest.h \
     $$PWD/common/musicsourceupdaterequest.h \
     $$PWD/common/musicdownloadcounterpvrequest.h \
@@ -115,6 +119,8 @@ HEADERS  += \
     $$PWD/radio/mv/musicabstractmvradiorequest.h \
     $$PWD/musicnetworkdefines.h \
     $$PWD/musicabstractqueryrequest.h \
+    $$PWD/musicfederatedqueryrequest.h \
+    $$PWD/musicsongattributeresolver.h \
     $$PWD/musicabstractnetwork.h \
     $$PWD/musicabstractdownloadrequest.h \
     $$PWD/musicdownloadqueryfactory.h \
@@ -136,6 +142,9 @@ HEADERS  += \
 
 SOURCES += \
     $$PWD/common/musicnetworkthread.cpp \
+    $$PWD/common/musicnetworkcache.cpp \
+    $$PWD/common/musicnetworksession.cpp \
+    $$PWD/common/musicurlsizeprobe.cpp \
     $$PWD/common/musicnetworkproxy.cpp \
     $$PWD/common/musicnetworkoperator.cpp \
     $$PWD/common/musicdownloaddatarequest.cpp \
@@ -144,6 +153,7 @@ SOURCES += \
     $$PWD/common/musicdownloadsourcerequest.cpp \
     $$PWD/common/musicdownloadbackgroundrequest.cpp \
     $$PWD/common/musicdownloadqueuerequest.cpp \
+    $$PWD/common/musicsongprefetcher.cpp \
     $$PWD/common/musicidentifysongsrequest.cpp \
     $$PWD/common/musicsourceupdaterequest.cpp \
     $$PWD/common/musicdownloadcounterpvrequest.cpp \
@@ -220,6 +230,8 @@ SOURCES += \
     $$PWD/radio/mv/musicmvradioprogramrequest.cpp \
     $$PWD/radio/mv/musicabstractmvradiorequest.cpp \
     $$PWD/musicabstractqueryrequest.cpp \
+    $$PWD/musicfederatedqueryrequest.cpp \
+    $$PWD/musicsongattributeresolver.cpp \
     $$PWD/musicabstractnetwork.cpp \
     $$PWD/musicabstractdownloadrequest.cpp \
     $$PWD/musicdownloadqueryfactory.cpp \
@@ -1,7 +1,23 @@
 #include "musicdownloaddatarequest.h"
 #include "musicdownloadmanager.h"
+#include "musicdownloadcachemanager.h"
 #include "musicnumberutils.h"
 
+#include <QDir>
+#include <QDateTime>
+#include <QDataStream>
+
+#define SEGMENT_MIN_SIZE        (4 * MH_MB2B)
+#define SEGMENT_MAX_COUNT       4
+#define SEGMENT_RETRY_COUNT     3
+#define SEGMENT_REDIRECT_MAX    5
+#define SEGMENT_JOURNAL_MAGIC   0x4D44534A
+#define SEGMENT_JOURNAL_VERSION 2
+#define SEGMENT_EXPIRE_DAYS     7
+#define SEGMENT_PART_SUFFIX     ".part"
+#define SEGMENT_JOURNAL_SUFFIX  ".journal"
+#define SEGMENT_PROPERTY        "probeRedirect"
+
 MusicDownloadDataRequest::MusicDownloadDataRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent)
     : MusicAbstractDownLoadRequest(url, save, type, parent)
 {
@@ -9,21 +25,47 @@ MusicDownloadDataRequest::MusicDownloadDataRequest(const QString &url, const QSt
     m_redirection = false;
     m_needUpdate = true;
     m_recordType = MusicObject::RecordNull;
+    m_segmentSize = 0;
+    m_segmentFile = nullptr;
+}
+
+void MusicDownloadDataRequest::deleteAll()
+{
+    for(MusicDownloadSegment &segment : m_segments)
+    {
+        if(segment.m_reply)
+        {
+            segment.m_reply->disconnect(this);
+            segment.m_reply->abort();
+            segment.m_reply->deleteLater();
+            segment.m_reply = nullptr;
+        }
+    }
+
+    if(m_segmentFile)
+    {
+        ///keep partial file and journal for resume, it takes cache space until then
+        writeJournal();
+        m_segmentFile->close();
+        G_DOWNLOAD_CACHE_PTR->insert(m_segmentFile->fileName());
+        delete m_segmentFile;
+        m_segmentFile = nullptr;
+    }
+
+    MusicAbstractDownLoadRequest::deleteAll();
 }
 
 void MusicDownloadDataRequest::startToDownload()
 {
     if(m_file && (!m_file->exists() || m_file->size() < 4))
     {
-        if(m_file->open(QIODevice::WriteOnly))
+        if(m_downloadType == MusicObject::DownloadMusic || m_downloadType == MusicObject::DownloadVideo || m_downloadType == MusicObject::DownloadOther)
         {
-            startRequest(m_url);
+            startToProbe(m_url, 0);
         }
         else
         {
-            TTK_LOGGER_ERROR("The data file create failed");
-            Q_EMIT downLoadDataChanged("The data file create failed");
-            deleteAll();
+            startToSingleDownload(m_url);
         }
     }
 }
@@ -51,8 +93,325 @@ void MusicDownloadDataRequest::startRequest(const QUrl &url)
     connect(m_reply, SIGNAL(error(QNetworkReply::NetworkError)), SLOT(replyError(QNetworkReply::NetworkError)));
     connect(m_reply, SIGNAL(readyRead()),this, SLOT(downLoadReadyRead()));
     connect(m_reply, SIGNAL(downloadProgress(qint64, qint64)), SLOT(downloadProgress(qint64, qint64)));
+
+    if(!m_redirection)
+    {
+        createDownloadRecord();
+    }
+}
+
+void MusicDownloadDataRequest::startToSingleDownload(const QUrl &url)
+{
+    if(m_file->open(QIODevice::WriteOnly))
+    {
+        startRequest(url);
+    }
+    else
+    {
+        TTK_LOGGER_ERROR("The data file create failed");
+        Q_EMIT downLoadDataChanged("The data file create failed");
+        deleteAll();
+    }
+}
+
+void MusicDownloadDataRequest::startToProbe(const QUrl &url, int redirect)
+{
+    if(!m_manager)
+    {
+        return;
+    }
+
+    QNetworkRequest request;
+    request.setUrl(url);
+    MusicObject::setSslConfiguration(&request);
+
+    m_reply = m_manager->head(request);
+    m_reply->setProperty(SEGMENT_PROPERTY, redirect);
+    connect(m_reply, SIGNAL(finished()), this, SLOT(probeFinished()));
+}
+
+void MusicDownloadDataRequest::probeFinished()
+{
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply || reply != m_reply || !m_file)
+    {
+        return;
+    }
+
+    m_reply = nullptr;
+    reply->deleteLater();
+
+    const QUrl &url = reply->url();
+    const int redirect = reply->property(SEGMENT_PROPERTY).toInt();
+    const QVariant &redirectionTarget = reply->attribute(QNetworkRequest::RedirectionTargetAttribute);
+    if(reply->error() == QNetworkReply::NoError && !redirectionTarget.isNull() && redirect < SEGMENT_REDIRECT_MAX)
+    {
+        startToProbe(url.resolved(redirectionTarget.toUrl()), redirect + 1);
+        return;
+    }
+
+    const qint64 size = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+    const bool ranges = reply->rawHeader("Accept-Ranges").toLower().contains("bytes");
+    if(reply->error() != QNetworkReply::NoError || !ranges || size < SEGMENT_MIN_SIZE)
+    {
+        ///servers without range or head support, or small files
+        startToSingleDownload(reply->error() == QNetworkReply::NoError ? url : QUrl(m_url));
+        return;
+    }
+
+    ///if-range only accepts strong validators
+    m_segmentValidator = reply->rawHeader("ETag");
+    if(m_segmentValidator.isEmpty() || m_segmentValidator.startsWith("W/"))
+    {
+        m_segmentValidator = reply->rawHeader("Last-Modified");
+    }
+
+    startToSegmentDownload(url, size);
+}
+
+void MusicDownloadDataRequest::startToSegmentDownload(const QUrl &url, qint64 size)
+{
+    m_segmentUrl = url;
+    m_segmentSize = size;
+    m_segmentFile = new QFile(m_savePath + SEGMENT_PART_SUFFIX, this);
+    removeExpiredSegments();
+
+    if(!readJournal(size))
+    {
+        m_segments.clear();
+        const int count = qMin<qint64>(SEGMENT_MAX_COUNT, size / SEGMENT_MIN_SIZE);
+        const qint64 length = size / count;
+        for(int i = 0; i < count; ++i)
+        {
+            MusicDownloadSegment segment;
+            segment.m_start = i * length;
+            segment.m_end = (i == count - 1) ? size - 1 : (i + 1) * length - 1;
+            m_segments << segment;
+        }
+
+        G_DOWNLOAD_CACHE_PTR->remove(m_segmentFile->fileName());
+        m_segmentFile->remove();
+        QFile::remove(m_savePath + SEGMENT_JOURNAL_SUFFIX);
+    }
+
+    if(!m_segmentFile->open(QIODevice::ReadWrite) || !m_segmentFile->resize(size))
+    {
+        delete m_segmentFile;
+        m_segmentFile = nullptr;
+        TTK_LOGGER_ERROR("The data file create failed");
+        Q_EMIT downLoadDataChanged("The data file create failed");
+        deleteAll();
+        return;
+    }
+
+    createDownloadRecord();
+    m_speedTimer.start();
+
+    qint64 received = 0;
+    for(int i = 0; i < m_segments.count(); ++i)
+    {
+        received += m_segments[i].m_received;
+        if(!m_segments[i].isFinished())
+        {
+            startSegment(i);
+        }
+    }
+
+    downloadProgress(received, m_segmentSize);
+    if(received >= m_segmentSize)
+    {
+        downLoadFinished();
+    }
+}
+
+void MusicDownloadDataRequest::startSegment(int index)
+{
+    MusicDownloadSegment *segment = &m_segments[index];
+
+    QNetworkRequest request;
+    request.setUrl(m_segmentUrl);
+    request.setRawHeader("Range", QString("bytes=%1-%2").arg(segment->m_start + segment->m_received).arg(segment->m_end).toUtf8());
+    if(!m_segmentValidator.isEmpty())
+    {
+        ///the whole file is sent with status 200 if it has changed since the partial file was written
+        request.setRawHeader("If-Range", m_segmentValidator);
+    }
+    MusicObject::setSslConfiguration(&request);
+
+    segment->m_reply = m_manager->get(request);
+    connect(segment->m_reply, SIGNAL(readyRead()), SLOT(segmentReadyRead()));
+    connect(segment->m_reply, SIGNAL(metaDataChanged()), SLOT(segmentMetaDataChanged()));
+    connect(segment->m_reply, SIGNAL(finished()), SLOT(segmentFinished()));
+}
+
+void MusicDownloadDataRequest::segmentReadyRead()
+{
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    for(MusicDownloadSegment &segment : m_segments)
+    {
+        if(segment.m_reply == reply)
+        {
+            writeSegmentData(&segment, reply);
+            break;
+        }
+    }
+}
+
+void MusicDownloadDataRequest::segmentMetaDataChanged()
+{
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply || !m_segmentFile)
+    {
+        return;
+    }
+
+    ///range is ignored by server when the status is not partial content, the whole file would be sent
+    const int code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(code != 0 && code != 206)
+    {
+        TTK_LOGGER_ERROR(QString("Range request is not supported or file changed, status %1").arg(code));
+        fallbackToSingleDownload();
+    }
+}
+
+void MusicDownloadDataRequest::segmentFinished()
+{
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    int index = -1;
+    for(int i = 0; i < m_segments.count(); ++i)
+    {
+        if(m_segments[i].m_reply == reply)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    if(index == -1)
+    {
+        return;
+    }
+
+    MusicDownloadSegment *segment = &m_segments[index];
+    writeSegmentData(segment, reply);
+    segment->m_reply = nullptr;
+    reply->deleteLater();
+
+    const int code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(reply->error() == QNetworkReply::NoError && code != 206)
+    {
+        fallbackToSingleDownload();
+        return;
+    }
+
+    if(!segment->isFinished())
+    {
+        if(++segment->m_retry > SEGMENT_RETRY_COUNT)
+        {
+            TTK_LOGGER_ERROR("Abnormal network connection");
+            Q_EMIT downLoadDataChanged("Abnormal network connection");
+            deleteAll();
+            return;
+        }
+
+        startSegment(index);
+        return;
+    }
+
+    for(const MusicDownloadSegment &v : qAsConst(m_segments))
+    {
+        if(!v.isFinished())
+        {
+            return;
+        }
+    }
+
+    downLoadFinished();
+}
+
+void MusicDownloadDataRequest::writeSegmentData(MusicDownloadSegment *segment, QNetworkReply *reply)
+{
+    if(!m_segmentFile || reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() != 206)
+    {
+        return;
+    }
+
+    const QByteArray &data = reply->read(segment->length() - segment->m_received);
+    if(data.isEmpty() || !m_segmentFile->seek(segment->m_start + segment->m_received))
+    {
+        return;
+    }
+
+    segment->m_received += m_segmentFile->write(data);
+
+    qint64 received = 0;
+    for(const MusicDownloadSegment &v : qAsConst(m_segments))
+    {
+        received += v.m_received;
+    }
+    downloadProgress(received, m_segmentSize);
+}
+
+void MusicDownloadDataRequest::fallbackToSingleDownload()
+{
+    for(MusicDownloadSegment &segment : m_segments)
+    {
+        if(segment.m_reply)
+        {
+            segment.m_reply->disconnect(this);
+            segment.m_reply->abort();
+            segment.m_reply->deleteLater();
+            segment.m_reply = nullptr;
+        }
+    }
+    m_segments.clear();
+
+    const QString &path = m_segmentFile->fileName();
+    m_segmentFile->close();
+    delete m_segmentFile;
+    m_segmentFile = nullptr;
+
+    G_DOWNLOAD_CACHE_PTR->remove(path);
+    QFile::remove(path);
+    QFile::remove(m_savePath + SEGMENT_JOURNAL_SUFFIX);
+
+    ///the download record is already created by segment download
+    m_redirection = true;
+    startToSingleDownload(m_segmentUrl);
+}
+
+bool MusicDownloadDataRequest::finishSegments()
+{
+    const QString &path = m_segmentFile->fileName();
+    m_segmentFile->close();
+    const qint64 size = m_segmentFile->size();
+    delete m_segmentFile;
+    m_segmentFile = nullptr;
+    ///the partial file is either removed or becomes the saved file
+    G_DOWNLOAD_CACHE_PTR->remove(path);
+
+    qint64 received = 0;
+    for(const MusicDownloadSegment &segment : qAsConst(m_segments))
+    {
+        received += segment.m_received;
+    }
+
+    QFile::remove(m_savePath + SEGMENT_JOURNAL_SUFFIX);
+    if(received != m_segmentSize || size != m_segmentSize)
+    {
+        TTK_LOGGER_ERROR(QString("Download size verify failed, expect %1 but %2").arg(m_segmentSize).arg(received));
+        QFile::remove(path);
+        return false;
+    }
+
+    QFile::remove(m_savePath);
+    return QFile::rename(path, m_savePath);
+}
+
+void MusicDownloadDataRequest::createDownloadRecord()
+{
     /// only download music data can that show progress
-    if(m_downloadType == MusicObject::DownloadMusic && !m_redirection)
+    if(m_downloadType == MusicObject::DownloadMusic)
     {
         m_createItemTime = MusicTime::timestamp();
         G_DOWNLOAD_MANAGER_PTR->connectMusicDownload(MusicDownLoadPairData(m_createItemTime, this, m_recordType));
@@ -60,8 +419,114 @@ void MusicDownloadDataRequest::startRequest(const QUrl &url)
     }
 }
 
+bool MusicDownloadDataRequest::readJournal(qint64 size)
+{
+    ///without validator the partial file can not be proved to belong to the same file
+    QFile file(m_savePath + SEGMENT_JOURNAL_SUFFIX);
+    if(m_segmentValidator.isEmpty() || !file.open(QIODevice::ReadOnly) || m_segmentFile->size() != size)
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_6);
+
+    quint32 magic = 0;
+    int version = 0;
+    stream >> magic >> version;
+    if(magic != SEGMENT_JOURNAL_MAGIC || version != SEGMENT_JOURNAL_VERSION)
+    {
+        return false;
+    }
+
+    QString url;
+    QByteArray validator;
+    qint64 total = 0;
+    int count = 0;
+    stream >> url >> validator >> total >> count;
+    if(url != m_url || validator != m_segmentValidator || total != size || count <= 0 || count > SEGMENT_MAX_COUNT)
+    {
+        return false;
+    }
+
+    m_segments.clear();
+    for(int i = 0; i < count; ++i)
+    {
+        MusicDownloadSegment segment;
+        stream >> segment.m_start >> segment.m_end >> segment.m_received;
+        m_segments << segment;
+    }
+
+    return stream.status() == QDataStream::Ok;
+}
+
+void MusicDownloadDataRequest::writeJournal() const
+{
+    if(m_segmentFile)
+    {
+        m_segmentFile->flush();
+    }
+
+    QFile file(m_savePath + SEGMENT_JOURNAL_SUFFIX);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_6);
+    stream << quint32(SEGMENT_JOURNAL_MAGIC) << int(SEGMENT_JOURNAL_VERSION);
+    stream << m_url << m_segmentValidator << m_segmentSize << m_segments.count();
+    for(const MusicDownloadSegment &segment : qAsConst(m_segments))
+    {
+        stream << segment.m_start << segment.m_end << segment.m_received;
+    }
+}
+
+void MusicDownloadDataRequest::removeExpiredSegments() const
+{
+    ///every dir is checked once a session, downloads that are never started again leave their segments behind
+    static QStringList dirs;
+    const QFileInfo info(m_savePath);
+    const QString &dir = info.absolutePath();
+    if(dirs.contains(dir))
+    {
+        return;
+    }
+    dirs << dir;
+
+    const QDateTime &expire = QDateTime::currentDateTime().addDays(-SEGMENT_EXPIRE_DAYS);
+    const QFileInfoList &files = QDir(dir).entryInfoList(QStringList() << "*" SEGMENT_PART_SUFFIX << "*" SEGMENT_JOURNAL_SUFFIX, QDir::Files);
+    for(const QFileInfo &file : qAsConst(files))
+    {
+        if(file.lastModified() < expire)
+        {
+            G_DOWNLOAD_CACHE_PTR->remove(file.absoluteFilePath());
+            QFile::remove(file.absoluteFilePath());
+        }
+    }
+}
+
 void MusicDownloadDataRequest::downLoadFinished()
 {
+    if(m_segmentFile)
+    {
+        MusicAbstractDownLoadRequest::downLoadFinished();
+        m_redirection = false;
+        if(!finishSegments())
+        {
+            m_stateCode = MusicObject::NetworkError;
+            Q_EMIT downLoadDataChanged("The data file verify failed");
+        }
+        else if(m_needUpdate)
+        {
+            Q_EMIT downLoadDataChanged(mapCurrentQueryData());
+            TTK_LOGGER_INFO("data download has finished");
+        }
+        deleteAll();
+        return;
+    }
+
     if(!m_file || !m_reply)
     {
         deleteAll();
@@ -125,4 +590,9 @@ void MusicDownloadDataRequest::updateDownloadSpeed()
 
     Q_EMIT downloadSpeedLabelChanged(label, time);
     MusicAbstractDownLoadRequest::updateDownloadSpeed();
+
+    if(m_segmentFile)
+    {
+        writeJournal();
+    }
 }
@@ -21,7 +21,35 @@
 
 #include "musicabstractdownloadrequest.h"
 
+/*! @brief The class of the download data segment.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicDownloadSegment
+{
+    qint64 m_start;
+    qint64 m_end;
+    qint64 m_received;
+    int m_retry;
+    QPointer<QNetworkReply> m_reply;
+
+    MusicDownloadSegment()
+    {
+        m_start = 0;
+        m_end = 0;
+        m_received = 0;
+        m_retry = 0;
+    }
+
+    inline qint64 length() const { return m_end - m_start + 1; }
+    inline bool isFinished() const { return m_received >= length(); }
+}MusicDownloadSegment;
+TTK_DECLARE_LISTS(MusicDownloadSegment)
+
 /*! @brief The class of downloading the type of data.
+ * Large music and video files are split into http range segments fetched
+ * in parallel, the partial file and a resume journal are kept beside the
+ * save path until the size is verified. A partial file is resumed only when
+ * the url and the validator (etag or last modified) of the file still match.
  * @author Greedysky <greedysky@163.com>
  */
 class TTK_MODULE_EXPORT MusicDownloadDataRequest : public MusicAbstractDownLoadRequest
@@ -34,6 +62,10 @@ public:
      */
     MusicDownloadDataRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent = nullptr);
 
+    /*!
+     * Release the network object.
+     */
+    virtual void deleteAll() override;
     /*!
      * Start to download data.
      */
@@ -80,15 +112,82 @@ public Q_SLOTS:
      */
     void downLoadReadyRead();
 
+private Q_SLOTS:
+    /*!
+     * Head request finished, choose segmented or single download.
+     */
+    void probeFinished();
+    /*!
+     * Segment received data ready.
+     */
+    void segmentReadyRead();
+    /*!
+     * Segment response headers received.
+     */
+    void segmentMetaDataChanged();
+    /*!
+     * Segment request finished.
+     */
+    void segmentFinished();
+
 protected:
     /*!
      * Start to download data from url.
      */
     void startRequest(const QUrl &url);
+    /*!
+     * Start to download data from url by one request.
+     */
+    void startToSingleDownload(const QUrl &url);
+    /*!
+     * Start head request to check range support.
+     */
+    void startToProbe(const QUrl &url, int redirect);
+    /*!
+     * Start to download data by range segments.
+     */
+    void startToSegmentDownload(const QUrl &url, qint64 size);
+    /*!
+     * Start range request of segment.
+     */
+    void startSegment(int index);
+    /*!
+     * Write the received data of segment reply.
+     */
+    void writeSegmentData(MusicDownloadSegment *segment, QNetworkReply *reply);
+    /*!
+     * Drop range segments and download data by one request.
+     */
+    void fallbackToSingleDownload();
+    /*!
+     * Verify the partial file and move it to save path.
+     */
+    bool finishSegments();
+    /*!
+     * Create download item in download record.
+     */
+    void createDownloadRecord();
+    /*!
+     * Read resume journal of partial file.
+     */
+    bool readJournal(qint64 size);
+    /*!
+     * Write resume journal of partial file.
+     */
+    void writeJournal() const;
+    /*!
+     * Remove expired partial files and journals beside the save path.
+     */
+    void removeExpiredSegments() const;
 
     qint64 m_createItemTime;
     bool m_redirection, m_needUpdate;
     MusicObject::RecordType m_recordType;
+    QUrl m_segmentUrl;
+    QByteArray m_segmentValidator;
+    qint64 m_segmentSize;
+    QFile *m_segmentFile;
+    MusicDownloadSegments m_segments;
 };
 
 #endif // MUSICDOWNLOADDATAREQUEST_H
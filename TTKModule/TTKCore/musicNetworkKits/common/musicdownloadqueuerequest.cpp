@@ -1,7 +1,18 @@
 #include "musicdownloadqueuerequest.h"
+#include "musicdownloadcachemanager.h"
 
 #include <QStringList>
 
+#include <algorithm>
+
+#define QUEUE_MAX_COUNT         4
+#define QUEUE_HOST_MAX_COUNT    2
+
+static bool queueDataPriorityLessThan(const MusicDownloadQueueData &a, const MusicDownloadQueueData &b)
+{
+    return a.m_priority > b.m_priority;
+}
+
 MusicDownloadQueueRequest::MusicDownloadQueueRequest(MusicObject::DownloadType  type, QObject *parent)
     : MusicDownloadQueueRequest(MusicDownloadQueueData(), type, parent)
 {
@@ -11,9 +22,6 @@ MusicDownloadQueueRequest::MusicDownloadQueueRequest(MusicObject::DownloadType
 MusicDownloadQueueRequest::MusicDownloadQueueRequest(const MusicDownloadQueueData &data, MusicObject::DownloadType  type, QObject *parent)
     : MusicAbstractDownLoadRequest(data.m_url, data.m_savePath, type, parent)
 {
-    m_isDownload = false;
-    m_isAbort = false;
-
     m_request = new QNetworkRequest;
     MusicObject::setSslConfiguration(m_request);
 }
@@ -26,6 +34,7 @@ MusicDownloadQueueRequest::MusicDownloadQueueRequest(const MusicDownloadQueueDat
 
 MusicDownloadQueueRequest::~MusicDownloadQueueRequest()
 {
+    abort();
     if(m_request)
     {
         delete m_request;
@@ -44,115 +53,177 @@ void MusicDownloadQueueRequest::startToDownload()
 
 void MusicDownloadQueueRequest::abort()
 {
-    if(m_isDownload && m_reply)
+    clear();
+
+    const QList<QNetworkReply*> replies(m_replies.keys());
+    for(QNetworkReply *reply : qAsConst(replies))
     {
-        m_isAbort = true;
-        m_reply->abort();
-        m_file->close();
-        m_file->remove();
-        delete m_reply;
-        m_reply = nullptr;
-        m_isAbort = false;
+        releaseReply(reply);
+        reply->abort();
     }
 }
 
 void MusicDownloadQueueRequest::clear()
 {
     m_imageQueue.clear();
+    m_duplicates.clear();
 }
 
 void MusicDownloadQueueRequest::addImageQueue(const MusicDownloadQueueDatas &datas)
 {
-    m_imageQueue = datas;
+    clear();
+    for(const MusicDownloadQueueData &data : qAsConst(datas))
+    {
+        ///identical url is downloaded once and saved to every path
+        if(isPending(data.m_url))
+        {
+            m_duplicates.insert(data.m_url, data.m_savePath);
+        }
+        else
+        {
+            m_imageQueue << data;
+        }
+    }
+
+    std::stable_sort(m_imageQueue.begin(), m_imageQueue.end(), queueDataPriorityLessThan);
 }
 
 void MusicDownloadQueueRequest::startOrderImageQueue()
 {
-    if(!m_imageQueue.isEmpty() && G_NETWORK_PTR->isOnline())
+    if(!G_NETWORK_PTR->isOnline())
     {
-        if(QFile::exists(m_imageQueue.first().m_savePath))
+        return;
+    }
+
+    int index = 0;
+    while(m_replies.count() < QUEUE_MAX_COUNT && index < m_imageQueue.count())
+    {
+        const MusicDownloadQueueData &data = m_imageQueue[index];
+        if(QFile::exists(data.m_savePath))
         {
-            Q_EMIT downLoadDataChanged(m_imageQueue.takeFirst().m_savePath);
-            startOrderImageQueue();
+            const MusicDownloadQueueData item(m_imageQueue.takeAt(index));
+            Q_EMIT downLoadDataChanged(item.m_savePath);
+            continue;
         }
-        else
+
+        if(m_hosts.value(QUrl(data.m_url).host()) >= QUEUE_HOST_MAX_COUNT)
         {
-            startDownload(m_imageQueue.first().m_url);
+            ///host is busy, try the next item
+            ++index;
+            continue;
         }
+
+        startDownload(m_imageQueue.takeAt(index));
     }
 }
 
-void MusicDownloadQueueRequest::startDownload(const QString &url)
+void MusicDownloadQueueRequest::startDownload(const MusicDownloadQueueData &data)
 {
-    m_isDownload = true;
-    delete m_file;
-    m_file = new QFile(m_imageQueue.first().m_savePath, this);
-    if(!m_file->open(QFile::WriteOnly))
+    if(!m_request || !m_manager)
     {
-        m_file->close();
-        delete m_file;
-        m_file = nullptr;
         return;
     }
 
-    if(!m_request || !m_manager)
+    m_request->setUrl(data.m_url);
+    QNetworkReply *reply = m_manager->get(*m_request);
+    m_replies.insert(reply, data);
+    m_buffers.insert(reply, QByteArray());
+    ++m_hosts[reply->url().host()];
+
+    connect(reply, SIGNAL(finished()), SLOT(downLoadFinished()));
+    connect(reply, SIGNAL(readyRead()), SLOT(readyReadSlot()));
+    connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), SLOT(errorSlot(QNetworkReply::NetworkError)));
+}
+
+void MusicDownloadQueueRequest::releaseReply(QNetworkReply *reply)
+{
+    const QString &host = reply->url().host();
+    if(--m_hosts[host] <= 0)
     {
-        return;
+        m_hosts.remove(host);
     }
 
-    m_speedTimer.start();
-    m_request->setUrl(url);
-    m_reply = m_manager->get(*m_request);
-    connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
-    connect(m_reply, SIGNAL(readyRead()), SLOT(readyReadSlot()));
-    connect(m_reply, SIGNAL(error(QNetworkReply::NetworkError)), SLOT(errorSlot(QNetworkReply::NetworkError)));
+    m_replies.remove(reply);
+    m_buffers.remove(reply);
+    reply->disconnect(this);
+    reply->deleteLater();
+}
+
+bool MusicDownloadQueueRequest::isPending(const QString &url) const
+{
+    for(const MusicDownloadQueueData &data : qAsConst(m_imageQueue))
+    {
+        if(data.m_url == url)
+        {
+            return true;
+        }
+    }
+
+    for(const MusicDownloadQueueData &data : m_replies)
+    {
+        if(data.m_url == url)
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 void MusicDownloadQueueRequest::downLoadFinished()
 {
-    if(m_isAbort || !m_request || !m_manager || !m_reply || !m_file)
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply || !m_replies.contains(reply))
     {
         return;
     }
 
     MusicAbstractDownLoadRequest::downLoadFinished();
-    m_file->flush();
-    m_file->close();
-    m_reply->deleteLater();
-    m_reply = nullptr;
-    m_isDownload = false;
-    Q_EMIT downLoadDataChanged(m_imageQueue.takeFirst().m_savePath);
+    const MusicDownloadQueueData data(m_replies.value(reply));
+    const QByteArray buffer(m_buffers.value(reply) + reply->readAll());
+    const bool success = (reply->error() == QNetworkReply::NoError);
+    releaseReply(reply);
+
+    QStringList paths(data.m_savePath);
+    paths << m_duplicates.values(data.m_url);
+    m_duplicates.remove(data.m_url);
+
+    for(const QString &path : qAsConst(paths))
+    {
+        ///data is written at once, a failed download leaves no partial file
+        QFile file(path);
+        if(success && file.open(QIODevice::WriteOnly))
+        {
+            file.write(buffer);
+            file.close();
+            G_DOWNLOAD_CACHE_PTR->insert(path);
+            Q_EMIT downLoadDataChanged(path);
+        }
+    }
 
     startOrderImageQueue();
 }
 
 void MusicDownloadQueueRequest::readyReadSlot()
 {
-    if(!m_file || !m_reply)
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply || !m_buffers.contains(reply))
     {
         return;
     }
 
-    m_file->write(m_reply->readAll());
-    m_file->flush();
+    m_buffers[reply].append(reply->readAll());
 }
 
 void MusicDownloadQueueRequest::errorSlot(QNetworkReply::NetworkError code)
 {
-    if(!m_file || !m_reply)
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply)
     {
         return;
     }
 #ifndef TTK_DEBUG
     Q_UNUSED(code);
 #endif
-    TTK_LOGGER_ERROR(QString("QNetworkReply::NetworkError : %1 %2").arg(code).arg(m_reply->errorString()));
-    m_file->flush();
-    if(!m_isAbort)
-    {
-        m_reply->deleteLater();
-        m_reply = nullptr;
-    }
-
-    startToDownload();
+    TTK_LOGGER_ERROR(QString("QNetworkReply::NetworkError : %1 %2").arg(code).arg(reply->errorString()));
 }
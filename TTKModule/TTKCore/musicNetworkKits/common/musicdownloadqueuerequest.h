@@ -28,10 +28,19 @@ typedef struct TTK_MODULE_EXPORT MusicDownloadQueueData
 {
     QString m_url;        ///*download url*/
     QString m_savePath;   ///*save local path*/
+    int m_priority;       ///*higher priority downloads first*/
+
+    MusicDownloadQueueData()
+    {
+        m_priority = 0;
+    }
 }MusicDownloadQueueData;
 TTK_DECLARE_LISTS(MusicDownloadQueueData)
 
 /*! @brief The class of download data from queue request.
+ * Items are downloaded by priority with several concurrent requests and a
+ * per host limit, identical urls are fetched once and data is written to
+ * the save path when the request finished.
  * @author Greedysky <greedysky@163.com>
  */
 class TTK_MODULE_EXPORT MusicDownloadQueueRequest : public MusicAbstractDownLoadRequest
@@ -65,7 +74,7 @@ public:
      */
     virtual void startToDownload() override;
     /*!
-     * Abort current download request.
+     * Abort all download requests and clear the queue.
      */
     void abort();
     /*!
@@ -91,14 +100,25 @@ protected:
     /*!
      * Start to download data from url.
      */
-    void startDownload(const QString &url);
+    void startDownload(const MusicDownloadQueueData &data);
     /*!
-     * Start to download data in order.
+     * Start queued downloads until the concurrent limit.
      */
     void startOrderImageQueue();
+    /*!
+     * Release the running reply and its host slot.
+     */
+    void releaseReply(QNetworkReply *reply);
+    /*!
+     * Check url is queued or running.
+     */
+    bool isPending(const QString &url) const;
 
-    bool m_isDownload, m_isAbort;
     QList<MusicDownloadQueueData> m_imageQueue;
+    QMultiHash<QString, QString> m_duplicates;
+    QHash<QNetworkReply*, MusicDownloadQueueData> m_replies;
+    QHash<QNetworkReply*, QByteArray> m_buffers;
+    QHash<QString, int> m_hosts;
     QNetworkRequest *m_request;
 
 };
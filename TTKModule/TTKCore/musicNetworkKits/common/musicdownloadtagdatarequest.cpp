@@ -16,31 +16,13 @@ void MusicDownloadTagDataRequest::setSongMeta(MusicSongMeta &meta)
     m_musicMeta = std::move(meta);
 }
 
-void MusicDownloadTagDataRequest::startToDownload()
-{
-    if(m_file && (!m_file->exists() || m_file->size() < 4))
-    {
-        if(m_file->open(QIODevice::WriteOnly))
-        {
-            startRequest(m_url);
-            disconnect(m_reply, SIGNAL(finished()), this, SLOT(downLoadFinished()));
-            connect(m_reply, SIGNAL(finished()), this, SLOT(downLoadFinished()));
-        }
-        else
-        {
-            TTK_LOGGER_ERROR("The data file create failed");
-            Q_EMIT downLoadDataChanged("The data file create failed");
-            deleteAll();
-        }
-    }
-}
-
 void MusicDownloadTagDataRequest::downLoadFinished()
 {
     bool save = (m_file != nullptr);
     MusicDownloadDataRequest::downLoadFinished();
 
-    if(m_redirection)
+    ///redirected, or the error is already reported
+    if(m_redirection || m_stateCode == MusicObject::NetworkError)
     {
         return;
     }
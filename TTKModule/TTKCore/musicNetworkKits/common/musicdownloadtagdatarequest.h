@@ -39,10 +39,6 @@ public:
      * Set custom tags.
      */
     void setSongMeta(MusicSongMeta &meta);
-    /*!
-     * Start to download data.
-     */
-    virtual void startToDownload() override;
 
 Q_SIGNALS:
     /*!
@@ -0,0 +1,269 @@
+#include "musicnetworkcache.h"
+#include "musicobject.h"
+#include "musicfileutils.h"
+
+#include <QDir>
+#include <QDateTime>
+#include <QDataStream>
+#include <QCryptographicHash>
+
+#define CACHE_MAGIC_NUMBER      0x4D4E4331
+#define CACHE_MAXIMUM_SIZE      (50 * MH_MB2B)
+#define CACHE_FRESH_TIME        (5 * MT_M2MS)
+#define CACHE_STALE_TIME        (7 * MT_D2MS)
+
+MusicNetworkCacheReply::MusicNetworkCacheReply(QNetworkAccessManager::Operation op, const QNetworkRequest &request, const QByteArray &data, QObject *parent)
+    : QNetworkReply(parent)
+    , m_data(data)
+    , m_offset(0)
+{
+    setOperation(op);
+    setRequest(request);
+    setUrl(request.url());
+    open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+
+    setHeader(QNetworkRequest::ContentLengthHeader, m_data.size());
+    setAttribute(QNetworkRequest::HttpStatusCodeAttribute, 200);
+    setAttribute(QNetworkRequest::SourceIsFromCacheAttribute, true);
+
+    ///signals are sent after the caller connected to them
+    QMetaObject::invokeMethod(this, "finish", Qt::QueuedConnection);
+}
+
+void MusicNetworkCacheReply::abort()
+{
+    if(isFinished())
+    {
+        return;
+    }
+
+    m_data.clear();
+    m_offset = 0;
+    setError(QNetworkReply::OperationCanceledError, "Operation canceled");
+}
+
+qint64 MusicNetworkCacheReply::bytesAvailable() const
+{
+    return m_data.size() - m_offset + QNetworkReply::bytesAvailable();
+}
+
+bool MusicNetworkCacheReply::isSequential() const
+{
+    return true;
+}
+
+void MusicNetworkCacheReply::finish()
+{
+    if(isFinished())
+    {
+        return;
+    }
+
+    if(error() == QNetworkReply::NoError)
+    {
+        Q_EMIT metaDataChanged();
+        Q_EMIT downloadProgress(m_data.size(), m_data.size());
+        Q_EMIT readyRead();
+    }
+    else
+    {
+        Q_EMIT error(error());
+    }
+
+    setFinished(true);
+    Q_EMIT finished();
+}
+
+qint64 MusicNetworkCacheReply::readData(char *data, qint64 maxSize)
+{
+    if(m_offset >= m_data.size())
+    {
+        return -1;
+    }
+
+    const qint64 count = qMin(maxSize, m_data.size() - m_offset);
+    memcpy(data, m_data.constData() + m_offset, count);
+    m_offset += count;
+    return count;
+}
+
+
+
+QString MusicNetworkCache::cacheKey(const QUrl &url, const QByteArray &body)
+{
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(QUrl::fromPercentEncoding(url.toEncoded()).toUtf8());
+    hash.addData("\n", 1);
+    hash.addData(body);
+    return hash.result().toHex();
+}
+
+bool MusicNetworkCache::isExpired(const MusicNetworkCacheItem &item)
+{
+    return QDateTime::currentMSecsSinceEpoch() - item.m_time > CACHE_FRESH_TIME;
+}
+
+bool MusicNetworkCache::find(const QString &key, MusicNetworkCacheItem *item)
+{
+    QMutexLocker locker(&m_mutex);
+    loadIndex();
+
+    auto it = m_items.find(key);
+    if(it == m_items.end())
+    {
+        return false;
+    }
+
+    if(!readItem(key, item) || QDateTime::currentMSecsSinceEpoch() - item->m_time > CACHE_STALE_TIME)
+    {
+        remove(key);
+        return false;
+    }
+
+    it.value().second = QDateTime::currentMSecsSinceEpoch();
+    return true;
+}
+
+void MusicNetworkCache::insert(const QString &key, const MusicNetworkCacheItem &item)
+{
+    QMutexLocker locker(&m_mutex);
+    loadIndex();
+
+    remove(key);
+    if(item.m_data.size() > m_maximumSize / 8 || !writeItem(key, item))
+    {
+        return;
+    }
+
+    expire();
+}
+
+void MusicNetworkCache::touch(const QString &key)
+{
+    QMutexLocker locker(&m_mutex);
+    loadIndex();
+
+    MusicNetworkCacheItem item;
+    if(!m_items.contains(key) || !readItem(key, &item))
+    {
+        return;
+    }
+
+    item.m_time = QDateTime::currentMSecsSinceEpoch();
+    remove(key);
+    writeItem(key, item);
+}
+
+void MusicNetworkCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    MusicUtils::File::removeRecursively(NETWORK_DIR_FULL, false);
+    m_items.clear();
+    m_currentSize = 0;
+    m_loaded = true;
+}
+
+void MusicNetworkCache::setMaximumCacheSize(qint64 size)
+{
+    QMutexLocker locker(&m_mutex);
+    m_maximumSize = size;
+    expire();
+}
+
+MusicNetworkCache::MusicNetworkCache()
+{
+    m_loaded = false;
+    m_currentSize = 0;
+    m_maximumSize = CACHE_MAXIMUM_SIZE;
+}
+
+void MusicNetworkCache::loadIndex()
+{
+    if(m_loaded)
+    {
+        return;
+    }
+
+    m_loaded = true;
+    QDir().mkpath(NETWORK_DIR_FULL);
+
+    const QFileInfoList &infos = QDir(NETWORK_DIR_FULL).entryInfoList(QDir::Files);
+    for(const QFileInfo &info : qAsConst(infos))
+    {
+        ///modified time is used as last access time after restart
+        m_items.insert(info.fileName(), qMakePair(info.size(), info.lastModified().toMSecsSinceEpoch()));
+        m_currentSize += info.size();
+    }
+
+    expire();
+}
+
+void MusicNetworkCache::expire()
+{
+    while(m_currentSize > m_maximumSize && !m_items.isEmpty())
+    {
+        auto oldest = m_items.begin();
+        for(auto it = m_items.begin(); it != m_items.end(); ++it)
+        {
+            if(it.value().second < oldest.value().second)
+            {
+                oldest = it;
+            }
+        }
+
+        remove(oldest.key());
+    }
+}
+
+void MusicNetworkCache::remove(const QString &key)
+{
+    auto it = m_items.find(key);
+    if(it == m_items.end())
+    {
+        return;
+    }
+
+    m_currentSize -= it.value().first;
+    m_items.erase(it);
+    QFile::remove(NETWORK_DIR_FULL + key);
+}
+
+bool MusicNetworkCache::readItem(const QString &key, MusicNetworkCacheItem *item) const
+{
+    QFile file(NETWORK_DIR_FULL + key);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_6);
+
+    quint32 magic = 0;
+    stream >> magic;
+    if(magic != CACHE_MAGIC_NUMBER)
+    {
+        return false;
+    }
+
+    stream >> item->m_time >> item->m_etag >> item->m_lastModified >> item->m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool MusicNetworkCache::writeItem(const QString &key, const MusicNetworkCacheItem &item)
+{
+    QFile file(NETWORK_DIR_FULL + key);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_4_6);
+    stream << quint32(CACHE_MAGIC_NUMBER) << item.m_time << item.m_etag << item.m_lastModified << item.m_data;
+    file.close();
+
+    m_items.insert(key, qMakePair(file.size(), QDateTime::currentMSecsSinceEpoch()));
+    m_currentSize += file.size();
+    return true;
+}
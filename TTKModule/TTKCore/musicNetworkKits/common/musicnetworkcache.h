@@ -0,0 +1,180 @@
+#ifndef MUSICNETWORKCACHE_H
+#define MUSICNETWORKCACHE_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QNetworkReply>
+#include "ttksingleton.h"
+#include "musicglobaldefine.h"
+
+/*! @brief The class of the network cache item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicNetworkCacheItem
+{
+    QByteArray m_data;
+    QByteArray m_etag;
+    QByteArray m_lastModified;
+    qint64 m_time;
+
+    MusicNetworkCacheItem()
+    {
+        m_time = 0;
+    }
+}MusicNetworkCacheItem;
+
+
+/*! @brief The class of the network cache reply served from disk.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicNetworkCacheReply : public QNetworkReply
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicNetworkCacheReply)
+public:
+    /*!
+     * Object contsructor.
+     */
+    MusicNetworkCacheReply(QNetworkAccessManager::Operation op, const QNetworkRequest &request, const QByteArray &data, QObject *parent = nullptr);
+
+    /*!
+     * Abort the reply.
+     */
+    virtual void abort() override;
+    /*!
+     * Get the bytes available of reply.
+     */
+    virtual qint64 bytesAvailable() const override;
+    /*!
+     * Reply data can only be read once.
+     */
+    virtual bool isSequential() const override;
+
+private Q_SLOTS:
+    /*!
+     * Emit the reply signals as a network reply does.
+     */
+    void finish();
+
+protected:
+    /*!
+     * Read data from cached data.
+     */
+    virtual qint64 readData(char *data, qint64 maxSize) override;
+
+    QByteArray m_data;
+    qint64 m_offset;
+
+};
+
+
+/*! @brief The class of the network response cache.
+ * Responses are stored on disk keyed on the decoded url and post body,
+ * evicted in least recently used order when the size limit is reached.
+ * A fresh response is served directly, a stale one is served at once and
+ * revalidated in background by etag and last modified.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicNetworkCache
+{
+    TTK_DECLARE_MODULE(MusicNetworkCache)
+public:
+    enum Attribute
+    {
+        CacheAttribute = QNetworkRequest::User + 1  /*!< request enables response cache*/
+    };
+
+    /*!
+     * Get the cache key of request.
+     */
+    static QString cacheKey(const QUrl &url, const QByteArray &body);
+    /*!
+     * Check cache item need revalidate.
+     */
+    static bool isExpired(const MusicNetworkCacheItem &item);
+
+    /*!
+     * Find cache item by key.
+     */
+    bool find(const QString &key, MusicNetworkCacheItem *item);
+    /*!
+     * Insert cache item by key.
+     */
+    void insert(const QString &key, const MusicNetworkCacheItem &item);
+    /*!
+     * Refresh cache item time when it is not modified.
+     */
+    void touch(const QString &key);
+    /*!
+     * Remove all cache items.
+     */
+    void clear();
+
+    /*!
+     * Set maximum cache size.
+     */
+    void setMaximumCacheSize(qint64 size);
+    /*!
+     * Get maximum cache size.
+     */
+    inline qint64 maximumCacheSize() const { return m_maximumSize; }
+    /*!
+     * Get current cache size.
+     */
+    inline qint64 cacheSize() const { return m_currentSize; }
+
+private:
+    /*!
+     * Object contsructor.
+     */
+    MusicNetworkCache();
+
+    /*!
+     * Load cache index from disk.
+     */
+    void loadIndex();
+    /*!
+     * Remove least recently used items until the size limit.
+     */
+    void expire();
+    /*!
+     * Remove cache item by key.
+     */
+    void remove(const QString &key);
+    /*!
+     * Read cache item from file.
+     */
+    bool readItem(const QString &key, MusicNetworkCacheItem *item) const;
+    /*!
+     * Write cache item to file.
+     */
+    bool writeItem(const QString &key, const MusicNetworkCacheItem &item);
+
+    QMutex m_mutex;
+    bool m_loaded;
+    qint64 m_currentSize, m_maximumSize;
+    QHash<QString, QPair<qint64, qint64> > m_items;
+
+    DECLARE_SINGLETON_CLASS(MusicNetworkCache)
+};
+
+#define G_NETWORK_CACHE_PTR GetMusicNetworkCache()
+TTK_MODULE_EXPORT MusicNetworkCache* GetMusicNetworkCache();
+
+#endif // MUSICNETWORKCACHE_H
@@ -0,0 +1,174 @@
+#include "musicnetworksession.h"
+#include "musicnetworkcache.h"
+
+#include <QSslError>
+#include <QDateTime>
+#include <QNetworkReply>
+#include <QThreadStorage>
+
+#define SESSION_CACHE_PROPERTY  "sessionCache"
+#define SESSION_CHECK_PROPERTY  "sessionRevalidate"
+
+MusicNetworkSession::MusicNetworkSession(QObject *parent)
+    : QNetworkAccessManager(parent)
+{
+#ifndef QT_NO_SSL
+    connect(this, SIGNAL(sslErrors(QNetworkReply*,QList<QSslError>)), SLOT(replySslErrors(QNetworkReply*,QList<QSslError>)));
+#endif
+}
+
+MusicNetworkSession *MusicNetworkSession::instance()
+{
+    static QThreadStorage<MusicNetworkSession*> sessions;
+    if(!sessions.hasLocalData())
+    {
+        sessions.setLocalData(new MusicNetworkSession);
+    }
+    return sessions.localData();
+}
+
+void MusicNetworkSession::replyFinished()
+{
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply)
+    {
+        return;
+    }
+
+    const QString &key = reply->property(SESSION_CACHE_PROPERTY).toString();
+    if(!key.isEmpty())
+    {
+        saveToCache(reply, key);
+    }
+
+    if(reply->property(SESSION_CHECK_PROPERTY).toBool())
+    {
+        ///background revalidation has no receiver
+        reply->deleteLater();
+    }
+}
+
+#ifndef QT_NO_SSL
+void MusicNetworkSession::replySslErrors(QNetworkReply *reply, const QList<QSslError> &errors)
+{
+    QString errorString;
+    for(const QSslError &error : qAsConst(errors))
+    {
+        if(!errorString.isEmpty())
+        {
+            errorString += ", ";
+        }
+        errorString += error.errorString();
+    }
+
+    TTK_LOGGER_ERROR(QString("sslErrors: %1").arg(errorString));
+    reply->ignoreSslErrors();
+}
+#endif
+
+QNetworkReply *MusicNetworkSession::createRequest(Operation op, const QNetworkRequest &request, QIODevice *outgoingData)
+{
+    QNetworkRequest req(request);
+#if TTK_QT_VERSION_CHECK(5,15,0)
+    req.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+#elif TTK_QT_VERSION_CHECK(5,8,0)
+    req.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, true);
+#endif
+
+    QString key;
+    if(req.attribute(QNetworkRequest::Attribute(MusicNetworkCache::CacheAttribute)).toBool() &&
+      (op == QNetworkAccessManager::GetOperation || op == QNetworkAccessManager::PostOperation) &&
+      (!outgoingData || !outgoingData->isSequential()))
+    {
+        const QByteArray &body = outgoingData ? outgoingData->peek(outgoingData->size()) : QByteArray();
+        key = MusicNetworkCache::cacheKey(req.url(), body);
+
+        MusicNetworkCacheItem item;
+        if(G_NETWORK_CACHE_PTR->find(key, &item))
+        {
+            if(MusicNetworkCache::isExpired(item))
+            {
+                revalidateCache(op, req, body, key, item);
+            }
+
+            QNetworkReply *reply = new MusicNetworkCacheReply(op, req, item.m_data, this);
+            connect(reply, SIGNAL(finished()), SLOT(replyFinished()));
+            return reply;
+        }
+    }
+
+    QNetworkReply *reply = QNetworkAccessManager::createRequest(op, req, outgoingData);
+    if(!key.isEmpty())
+    {
+        reply->setProperty(SESSION_CACHE_PROPERTY, key);
+    }
+
+    connect(reply, SIGNAL(finished()), SLOT(replyFinished()));
+    return reply;
+}
+
+void MusicNetworkSession::revalidateCache(Operation op, const QNetworkRequest &request, const QByteArray &body, const QString &key, const MusicNetworkCacheItem &item)
+{
+    QNetworkRequest req(request);
+    req.setAttribute(QNetworkRequest::Attribute(MusicNetworkCache::CacheAttribute), false);
+    if(!item.m_etag.isEmpty())
+    {
+        req.setRawHeader("If-None-Match", item.m_etag);
+    }
+
+    if(!item.m_lastModified.isEmpty())
+    {
+        req.setRawHeader("If-Modified-Since", item.m_lastModified);
+    }
+
+    QNetworkReply *reply = (op == QNetworkAccessManager::GetOperation) ? get(req) : post(req, body);
+    reply->setProperty(SESSION_CACHE_PROPERTY, key);
+    reply->setProperty(SESSION_CHECK_PROPERTY, true);
+}
+
+void MusicNetworkSession::saveToCache(QNetworkReply *reply, const QString &key)
+{
+    if(reply->error() != QNetworkReply::NoError)
+    {
+        return;
+    }
+
+    const int code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if(code == 304)
+    {
+        G_NETWORK_CACHE_PTR->touch(key);
+    }
+    else if(code == 200 && !reply->rawHeader("Cache-Control").contains("no-store"))
+    {
+        ///peek keeps the data for the receiver of the reply
+        MusicNetworkCacheItem item;
+        item.m_data = reply->peek(reply->bytesAvailable());
+        item.m_etag = reply->rawHeader("ETag");
+        item.m_lastModified = reply->rawHeader("Last-Modified");
+        item.m_time = QDateTime::currentMSecsSinceEpoch();
+        G_NETWORK_CACHE_PTR->insert(key, item);
+    }
+}
+
+
+
+MusicNetworkReplyGuard::MusicNetworkReplyGuard(QNetworkReply *reply)
+    : m_reply(reply)
+{
+
+}
+
+MusicNetworkReplyGuard::~MusicNetworkReplyGuard()
+{
+    if(!m_reply)
+    {
+        return;
+    }
+
+    ///a timed out reply would keep its host connection busy
+    if(m_reply->isRunning())
+    {
+        m_reply->abort();
+    }
+    delete m_reply.data();
+}
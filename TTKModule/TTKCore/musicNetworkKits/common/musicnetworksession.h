@@ -0,0 +1,98 @@
+#ifndef MUSICNETWORKSESSION_H
+#define MUSICNETWORKSESSION_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QPointer>
+#include <QNetworkAccessManager>
+#include "musicglobaldefine.h"
+
+struct MusicNetworkCacheItem;
+
+/*! @brief The class of the shared network session.
+ * One access manager per thread is shared by all network requests, so tcp and
+ * tls connections, dns lookups and authentication are reused between requests.
+ * Http keeps at most six persistent connections per host, http2 is used when
+ * the server and Qt version support it.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicNetworkSession : public QNetworkAccessManager
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicNetworkSession)
+public:
+    /*!
+     * Get the shared access manager of current thread.
+     */
+    static MusicNetworkSession *instance();
+
+private Q_SLOTS:
+    /*!
+     * Reply finished, save its data to response cache.
+     */
+    void replyFinished();
+#ifndef QT_NO_SSL
+    /*!
+     * Ignore ssl errors of all replies.
+     */
+    void replySslErrors(QNetworkReply *reply, const QList<QSslError> &errors);
+#endif
+
+protected:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicNetworkSession(QObject *parent = nullptr);
+
+    /*!
+     * Override the create request function.
+     */
+    virtual QNetworkReply *createRequest(Operation op, const QNetworkRequest &request, QIODevice *outgoingData = nullptr) override;
+    /*!
+     * Revalidate stale cache item in background.
+     */
+    void revalidateCache(Operation op, const QNetworkRequest &request, const QByteArray &body, const QString &key, const MusicNetworkCacheItem &item);
+    /*!
+     * Save reply data to response cache.
+     */
+    void saveToCache(QNetworkReply *reply, const QString &key);
+
+};
+
+
+/*! @brief The class of the shared session reply guard.
+ * Replies are not released with the shared session, the guard aborts the
+ * unfinished reply of a synchronous query and deletes it when out of scope.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicNetworkReplyGuard
+{
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicNetworkReplyGuard(QNetworkReply *reply);
+    ~MusicNetworkReplyGuard();
+
+private:
+    QPointer<QNetworkReply> m_reply;
+
+};
+
+#endif // MUSICNETWORKSESSION_H
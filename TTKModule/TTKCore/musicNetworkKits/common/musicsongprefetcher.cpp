@@ -0,0 +1,263 @@
+#include "musicsongprefetcher.h"
+#include "musicplaylist.h"
+#include "musicdownloadcachemanager.h"
+#include "musicdownloaddatarequest.h"
+
+#include <QDataStream>
+
+#define PREFETCH_VERSION        1
+#define PREFETCH_SUFFIX         ".prefetch"
+#define PREFETCH_SAVE_INTERVAL  5 * MT_S2MS
+
+static bool sourcesLoaded = false;
+static bool sourcesChanged = false;
+static QHash<QString, QString> sourceItems;
+static MusicSongPrefetcher *sourcesOwner = nullptr;
+
+static void loadSources()
+{
+    if(sourcesLoaded)
+    {
+        return;
+    }
+
+    sourcesLoaded = true;
+    QFile file(PREFETCHPATH_FULL);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    QDataStream stream(&file);
+    int version = 0;
+    stream >> version;
+    if(version == PREFETCH_VERSION)
+    {
+        stream >> sourceItems;
+    }
+}
+
+static void writeSources()
+{
+    if(!sourcesChanged)
+    {
+        return;
+    }
+
+    sourcesChanged = false;
+    QFile file(PREFETCHPATH_FULL);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << int(PREFETCH_VERSION) << sourceItems;
+}
+
+
+MusicSongPrefetcher::MusicSongPrefetcher(MusicPlaylist *playlist, QObject *parent)
+    : QObject(parent)
+{
+    m_pruned = false;
+    m_playlist = playlist;
+    sourcesOwner = this;
+
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(PREFETCH_SAVE_INTERVAL);
+    connect(&m_timer, SIGNAL(timeout()), SLOT(saveSources()));
+    connect(m_playlist, SIGNAL(currentIndexChanged(int)), SLOT(currentIndexChanged()));
+}
+
+MusicSongPrefetcher::~MusicSongPrefetcher()
+{
+    sourcesOwner = nullptr;
+    writeSources();
+}
+
+void MusicSongPrefetcher::addSource(const QString &path, const QString &url)
+{
+    loadSources();
+    if(url.isEmpty() || sourceItems.value(path) == url)
+    {
+        return;
+    }
+
+    sourceItems.insert(path, url);
+    changeSources();
+}
+
+QString MusicSongPrefetcher::findSource(const QString &path)
+{
+    loadSources();
+    return sourceItems.value(path);
+}
+
+void MusicSongPrefetcher::currentIndexChanged()
+{
+    m_pendings.clear();
+    if(m_playlist->currentIndex() < 0)
+    {
+        return;
+    }
+
+    if(!m_pruned)
+    {
+        pruneSources();
+    }
+
+    ///current track goes first, the next ones only start after it is ready
+    QStringList paths;
+    paths << m_playlist->currentMediaPath();
+
+    const MusicPlayItems *items = m_playlist->mediaList();
+    const MusicObject::PlayMode mode = m_playlist->playbackMode();
+    int index = (mode == MusicObject::PM_PlayOnce) ? -1 : m_playlist->nextIndex();
+    if(index >= 0 && index < items->count())
+    {
+        paths << items->at(index).m_path;
+
+        ///the one after next is only predictable in sequential modes
+        const bool sequential = mode == MusicObject::PM_PlayOrder || mode == MusicObject::PM_PlaylistLoop;
+        if(sequential && m_playlist->queueMediaList()->isEmpty())
+        {
+            if(++index >= items->count())
+            {
+                index = (mode == MusicObject::PM_PlaylistLoop) ? 0 : -1;
+            }
+
+            if(index >= 0)
+            {
+                paths << items->at(index).m_path;
+            }
+        }
+    }
+
+    for(const QString &path : qAsConst(paths))
+    {
+        if(needPrefetch(path) && !m_pendings.contains(path))
+        {
+            m_pendings << path;
+        }
+    }
+
+    startToPrefetch();
+}
+
+void MusicSongPrefetcher::downLoadDataChanged(const QString &data)
+{
+    const QString &path = m_currentPath + PREFETCH_SUFFIX;
+    if(data == "DownloadOther" && QFile::exists(path))
+    {
+        QFile::remove(m_currentPath);
+        QFile::rename(path, m_currentPath);
+        G_DOWNLOAD_CACHE_PTR->insert(m_currentPath);
+    }
+}
+
+void MusicSongPrefetcher::prefetchFinished()
+{
+    ///a failed download may leave a truncated file or segment leftovers, prefetch never resumes them
+    ///the request has recorded them in the cache index when it was released
+    const QString &path = m_currentPath + PREFETCH_SUFFIX;
+    G_DOWNLOAD_CACHE_PTR->remove(path);
+    G_DOWNLOAD_CACHE_PTR->remove(path + ".part");
+    QFile::remove(path);
+    QFile::remove(path + ".part");
+    QFile::remove(path + ".journal");
+    if(!QFile::exists(m_currentPath))
+    {
+        ///the source url is expired or gone, it is never tried again
+        m_failures << m_currentPath;
+        sourceItems.remove(m_currentPath);
+        changeSources();
+    }
+
+    m_currentPath.clear();
+    startToPrefetch();
+}
+
+void MusicSongPrefetcher::saveSources()
+{
+    writeSources();
+}
+
+void MusicSongPrefetcher::changeSources()
+{
+    sourcesChanged = true;
+    if(!sourcesOwner)
+    {
+        writeSources();
+    }
+    else if(!sourcesOwner->m_timer.isActive())
+    {
+        sourcesOwner->m_timer.start();
+    }
+}
+
+bool MusicSongPrefetcher::needPrefetch(const QString &path) const
+{
+    return !path.isEmpty() && path != m_currentPath && !m_failures.contains(path) && !QFile::exists(path) && !findSource(path).isEmpty();
+}
+
+bool MusicSongPrefetcher::withinBudget() const
+{
+    const qint64 size = G_DOWNLOAD_CACHE_PTR->maximumCacheSize();
+    return size < 0 || G_DOWNLOAD_CACHE_PTR->cacheSize() < size;
+}
+
+void MusicSongPrefetcher::startToPrefetch()
+{
+    if(!m_currentPath.isEmpty() || m_pendings.isEmpty() || !G_NETWORK_PTR->isOnline())
+    {
+        return;
+    }
+
+    if(!withinBudget())
+    {
+        m_pendings.clear();
+        return;
+    }
+
+    m_currentPath = m_pendings.takeFirst();
+    TTK_LOGGER_INFO(QString("%1 prefetch %2").arg(getClassName()).arg(m_currentPath));
+
+    MusicDownloadDataRequest *request = new MusicDownloadDataRequest(findSource(m_currentPath), m_currentPath + PREFETCH_SUFFIX, MusicObject::DownloadOther, this);
+    connect(request, SIGNAL(downLoadDataChanged(QString)), SLOT(downLoadDataChanged(QString)));
+    connect(request, SIGNAL(destroyed()), SLOT(prefetchFinished()));
+    request->startToDownload();
+}
+
+void MusicSongPrefetcher::pruneSources()
+{
+    m_pruned = true;
+    loadSources();
+
+    ///the playlist is complete once the first track is current
+    QSet<QString> paths;
+    const MusicPlayItems *items = m_playlist->mediaList();
+    for(const MusicPlayItem &item : qAsConst(*items))
+    {
+        paths.insert(item.m_path);
+    }
+
+    int count = 0;
+    for(auto it = sourceItems.begin(); it != sourceItems.end(); )
+    {
+        if(!paths.contains(it.key()) && !QFile::exists(it.key()))
+        {
+            it = sourceItems.erase(it);
+            ++count;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if(count > 0)
+    {
+        TTK_LOGGER_INFO(QString("%1 drop %2 sources").arg(getClassName()).arg(count));
+        changeSources();
+    }
+}
@@ -0,0 +1,104 @@
+#ifndef MUSICSONGPREFETCHER_H
+#define MUSICSONGPREFETCHER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QSet>
+#include <QTimer>
+#include "musicglobaldefine.h"
+
+class MusicPlaylist;
+
+/*! @brief The class of the online song prefetcher.
+ * Cached online songs of the current and the next tracks are downloaded
+ * again from their source url when missing, one at a time so the current
+ * track is never competing with the others. Source urls are saved with a
+ * delay, the ones of missing files out of the playlist are dropped.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongPrefetcher : public QObject
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicSongPrefetcher)
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicSongPrefetcher(MusicPlaylist *playlist, QObject *parent = nullptr);
+    ~MusicSongPrefetcher();
+
+    /*!
+     * Remember the source url of cached song path.
+     */
+    static void addSource(const QString &path, const QString &url);
+    /*!
+     * Find the source url of cached song path.
+     */
+    static QString findSource(const QString &path);
+
+private Q_SLOTS:
+    /*!
+     * Current play index changed, prefetch the upcoming tracks.
+     */
+    void currentIndexChanged();
+    /*!
+     * Prefetch data download finished.
+     */
+    void downLoadDataChanged(const QString &data);
+    /*!
+     * Prefetch request released, start the next one.
+     */
+    void prefetchFinished();
+    /*!
+     * Save changed source urls into file.
+     */
+    void saveSources();
+
+private:
+    /*!
+     * Schedule source urls saving.
+     */
+    static void changeSources();
+    /*!
+     * Check the path should be prefetched.
+     */
+    bool needPrefetch(const QString &path) const;
+    /*!
+     * Check the cache is under its size limit.
+     */
+    bool withinBudget() const;
+    /*!
+     * Start to prefetch next pending path.
+     */
+    void startToPrefetch();
+    /*!
+     * Drop source urls of missing files that are not in the playlist.
+     */
+    void pruneSources();
+
+    bool m_pruned;
+    QTimer m_timer;
+    MusicPlaylist *m_playlist;
+    QString m_currentPath;
+    QStringList m_pendings;
+    QSet<QString> m_failures;
+
+};
+
+#endif // MUSICSONGPREFETCHER_H
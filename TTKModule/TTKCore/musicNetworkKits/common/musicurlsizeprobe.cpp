@@ -0,0 +1,150 @@
+#include "musicurlsizeprobe.h"
+#include "musicabstractnetwork.h"
+
+#include <QMutex>
+#include <QDateTime>
+
+#define PROBE_CACHE_EXPIRE      (10 * MT_M2MS)
+#define PROBE_REDIRECT_MAX      5
+#define PROBE_REDIRECT_PROPERTY "probeRedirect"
+
+/*! @brief The class of the url file size cache item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct MusicUrlSizeCacheItem
+{
+    qint64 m_size;
+    qint64 m_time;
+}MusicUrlSizeCacheItem;
+
+static QMutex cacheMutex;
+static QHash<QString, MusicUrlSizeCacheItem> cacheItems;
+
+MusicUrlSizeProbe::MusicUrlSizeProbe(QObject *parent)
+    : QObject(parent)
+{
+
+}
+
+MusicUrlSizeProbe::~MusicUrlSizeProbe()
+{
+    abort();
+}
+
+void MusicUrlSizeProbe::probe(const QStringList &urls)
+{
+    const QStringList &pending = m_replies.values();
+    for(const QString &url : qAsConst(urls))
+    {
+        qint64 size = -1;
+        if(url.isEmpty() || pending.contains(url))
+        {
+            continue;
+        }
+        else if(findCache(url, &size))
+        {
+            Q_EMIT sizeChanged(url, size);
+        }
+        else
+        {
+            startToProbe(url, url, 0);
+        }
+    }
+
+    if(m_replies.isEmpty())
+    {
+        Q_EMIT finished();
+    }
+}
+
+void MusicUrlSizeProbe::abort()
+{
+    const QList<QNetworkReply*> replies(m_replies.keys());
+    m_replies.clear();
+
+    for(QNetworkReply *reply : qAsConst(replies))
+    {
+        reply->disconnect(this);
+        reply->abort();
+        reply->deleteLater();
+    }
+}
+
+bool MusicUrlSizeProbe::findCache(const QString &url, qint64 *size)
+{
+    QMutexLocker locker(&cacheMutex);
+    auto it = cacheItems.find(url);
+    if(it == cacheItems.end())
+    {
+        return false;
+    }
+
+    if(QDateTime::currentMSecsSinceEpoch() - it.value().m_time > PROBE_CACHE_EXPIRE)
+    {
+        cacheItems.erase(it);
+        return false;
+    }
+
+    *size = it.value().m_size;
+    return true;
+}
+
+void MusicUrlSizeProbe::insertCache(const QString &url, qint64 size)
+{
+    if(size < 0)
+    {
+        return;
+    }
+
+    MusicUrlSizeCacheItem item;
+    item.m_size = size;
+    item.m_time = QDateTime::currentMSecsSinceEpoch();
+
+    QMutexLocker locker(&cacheMutex);
+    cacheItems.insert(url, item);
+}
+
+void MusicUrlSizeProbe::replyFinished()
+{
+    QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(!reply || !m_replies.contains(reply))
+    {
+        return;
+    }
+
+    const QString &origin = m_replies.take(reply);
+    const int redirect = reply->property(PROBE_REDIRECT_PROPERTY).toInt();
+    reply->deleteLater();
+
+    qint64 size = -1;
+    if(reply->error() == QNetworkReply::NoError)
+    {
+        const QVariant &redirection = reply->attribute(QNetworkRequest::RedirectionTargetAttribute);
+        if(!redirection.isNull() && redirect < PROBE_REDIRECT_MAX)
+        {
+            startToProbe(reply->url().resolved(redirection.toUrl()).toString(), origin, redirect + 1);
+            return;
+        }
+
+        size = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+        insertCache(origin, size);
+    }
+
+    Q_EMIT sizeChanged(origin, size);
+    if(m_replies.isEmpty())
+    {
+        Q_EMIT finished();
+    }
+}
+
+void MusicUrlSizeProbe::startToProbe(const QString &url, const QString &origin, int redirect)
+{
+    QNetworkRequest request;
+    request.setUrl(url);
+    MusicObject::setSslConfiguration(&request);
+
+    QNetworkReply *reply = MusicNetworkSession::instance()->head(request);
+    reply->setProperty(PROBE_REDIRECT_PROPERTY, redirect);
+    m_replies.insert(reply, origin);
+    connect(reply, SIGNAL(finished()), SLOT(replyFinished()));
+}
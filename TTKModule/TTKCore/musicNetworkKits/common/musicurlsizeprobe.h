@@ -0,0 +1,90 @@
+#ifndef MUSICURLSIZEPROBE_H
+#define MUSICURLSIZEPROBE_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QNetworkReply>
+#include "musicglobaldefine.h"
+
+/*! @brief The class of the url file size probe.
+ * Sends all head requests at once, follows redirects without blocking
+ * and keeps probed sizes in a process wide cache for a while.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicUrlSizeProbe : public QObject
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicUrlSizeProbe)
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicUrlSizeProbe(QObject *parent = nullptr);
+    ~MusicUrlSizeProbe();
+
+    /*!
+     * Probe file size of urls, cached url is emitted directly.
+     */
+    void probe(const QStringList &urls);
+    /*!
+     * Abort all pending probes.
+     */
+    void abort();
+    /*!
+     * Check probe is running.
+     */
+    inline bool isRunning() const { return !m_replies.isEmpty(); }
+
+public:
+    /*!
+     * Find url file size in cache.
+     */
+    static bool findCache(const QString &url, qint64 *size);
+    /*!
+     * Insert url file size to cache.
+     */
+    static void insertCache(const QString &url, qint64 size);
+
+Q_SIGNALS:
+    /*!
+     * Url file size probed, size is -1 when failed.
+     */
+    void sizeChanged(const QString &url, qint64 size);
+    /*!
+     * All pending probes finished.
+     */
+    void finished();
+
+private Q_SLOTS:
+    /*!
+     * Head request finished.
+     */
+    void replyFinished();
+
+private:
+    /*!
+     * Start head request, origin is the url before redirection.
+     */
+    void startToProbe(const QString &url, const QString &origin, int redirect);
+
+    QHash<QNetworkReply*, QString> m_replies;
+
+};
+
+#endif // MUSICURLSIZEPROBE_H
@@ -115,6 +115,7 @@ void MusicBDQueryLearnRequest::readFromMusicSongAttribute(MusicObject::MusicSong
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -160,6 +161,7 @@ void MusicBDQueryLearnRequest::readFromMusicLrcAttribute(MusicObject::MusicSongI
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
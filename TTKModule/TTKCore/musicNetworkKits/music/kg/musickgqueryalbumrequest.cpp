@@ -147,6 +147,12 @@ void MusicKGQueryAlbumRequest::singleDownLoadFinished()
     MusicQueryAlbumRequest::downLoadFinished();
 
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         QJson::Parser parser;
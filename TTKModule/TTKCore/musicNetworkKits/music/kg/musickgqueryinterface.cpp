@@ -23,9 +23,10 @@ void MusicKGQueryInterface::readFromMusicSongAttribute(MusicObject::MusicSongInf
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -98,9 +99,10 @@ void MusicKGQueryInterface::readFromMusicSongLrcAndPicture(MusicObject::MusicSon
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -135,9 +137,10 @@ void MusicKGQueryInterface::readFromMusicSongAlbumInfo(MusicResultsItem *info, c
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
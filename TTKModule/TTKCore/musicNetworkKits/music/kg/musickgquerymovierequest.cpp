@@ -219,6 +219,7 @@ void MusicKGQueryMovieRequest::readFromMusicMVAttribute(MusicObject::MusicSongIn
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -281,6 +282,7 @@ void MusicKGQueryMovieRequest::readFromMusicMVInfo(MusicObject::MusicSongInforma
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
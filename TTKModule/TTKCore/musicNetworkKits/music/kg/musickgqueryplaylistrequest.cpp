@@ -37,6 +37,7 @@ void MusicKGQueryPlaylistRequest::startToPage(int offset)
     request.setUrl(MusicUtils::Algorithm::mdII(KG_PLAYLIST_URL, false).arg(m_queryText).arg(offset + 1).arg(m_pageSize));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     m_reply = m_manager->get(request);
     connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
@@ -58,6 +59,7 @@ void MusicKGQueryPlaylistRequest::startToSearch(const QString &playlist)
     request.setUrl(MusicUtils::Algorithm::mdII(KG_PLAYLIST_INFO_URL, false).arg(playlist));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     QNetworkReply *reply = m_manager->get(request);
     connect(reply, SIGNAL(finished()), SLOT(getDetailsFinished()));
@@ -79,9 +81,11 @@ void MusicKGQueryPlaylistRequest::getPlaylistInfo(MusicResultsItem &item)
     request.setUrl(MusicUtils::Algorithm::mdII(KG_PLAYLIST_DETAIL_URL, false).arg(item.m_id));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -180,11 +184,17 @@ void MusicKGQueryPlaylistRequest::getDetailsFinished()
 
     MusicQueryPlaylistRequest::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
-        QJson::Parser parser;
         bool ok;
-        const QVariant &data = parser.parse(reply->readAll(), &ok);
+        const QVariant &data = parseJsonData(reply->readAll(), &ok);
+        TTK_NETWORK_QUERY_CHECK();
         if(ok)
         {
             QVariantMap value = data.toMap();
@@ -109,37 +109,30 @@ void MusicKGQueryRequest::downLoadFinished()
                     musicInfo.m_discNumber = "1";
                     musicInfo.m_trackNumber = "0";
 
-                    TTK_NETWORK_QUERY_CHECK();
-                    readFromMusicSongLrcAndPicture(&musicInfo);
-                    TTK_NETWORK_QUERY_CHECK();
-
                     if(!m_querySimplify)
+                    {
+                        const QString quality(m_queryQuality);
+                        const bool all = m_queryAllRecords;
+                        resolveSongAttribute(musicInfo, [value, quality, all](MusicObject::MusicSongInformation *info)
+                        {
+                            MusicKGQueryInterface query;
+                            query.readFromMusicSongLrcAndPicture(info);
+                            query.readFromMusicSongAttribute(info, value, quality, all);
+                        });
+                    }
+                    else
                     {
                         TTK_NETWORK_QUERY_CHECK();
-                        readFromMusicSongAttribute(&musicInfo, value, m_queryQuality, m_queryAllRecords);
+                        readFromMusicSongLrcAndPicture(&musicInfo);
                         TTK_NETWORK_QUERY_CHECK();
-
-                        if(musicInfo.m_songAttrs.isEmpty())
-                        {
-                            continue;
-                        }
-                        //
-                        MusicSearchedItem item;
-                        item.m_songName = musicInfo.m_songName;
-                        item.m_singerName = musicInfo.m_singerName;
-                        item.m_albumName = musicInfo.m_albumName;
-                        item.m_time = musicInfo.m_timeLength;
-                        item.m_type = mapQueryServerString();
-                        Q_EMIT createSearchedItem(item);
+                        m_musicSongInfos << musicInfo;
                     }
-                    m_musicSongInfos << musicInfo;
                 }
             }
         }
     }
 
-    Q_EMIT downLoadDataChanged(QString());
-    deleteAll();
+    resolveSongAttributeFinished();
 }
 
 void MusicKGQueryRequest::singleDownLoadFinished()
@@ -148,6 +141,12 @@ void MusicKGQueryRequest::singleDownLoadFinished()
 
     MusicAbstractQueryRequest::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         QJson::Parser parser;
@@ -33,6 +33,7 @@ void MusicKGQueryToplistRequest::startToSearch(const QString &toplist)
     request.setUrl(MusicUtils::Algorithm::mdII(KG_TOPLIST_URL, false).arg(toplist));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KG_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     m_reply = m_manager->get(request);
     connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
@@ -46,9 +47,9 @@ void MusicKGQueryToplistRequest::downLoadFinished()
     MusicQueryToplistRequest::downLoadFinished();
     if(m_reply && m_reply->error() == QNetworkReply::NoError)
     {
-        QJson::Parser parser;
         bool ok;
-        const QVariant &data = parser.parse(m_reply->readAll(), &ok);
+        const QVariant &data = parseJsonData(m_reply->readAll(), &ok);
+        TTK_NETWORK_QUERY_CHECK();
         if(ok)
         {
             QVariantMap value = data.toMap();
@@ -77,9 +77,10 @@ QString MusicKWArtistSimilarRequest::getArtistNameById(const QString &id)
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -113,9 +114,10 @@ QString MusicKWArtistSimilarRequest::getArtistIdName(const QString &name)
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
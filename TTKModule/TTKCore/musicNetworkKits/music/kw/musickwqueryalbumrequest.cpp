@@ -150,6 +150,12 @@ void MusicKWQueryAlbumRequest::singleDownLoadFinished()
 
     MusicAbstractNetwork::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         QJson::Parser parser;
@@ -130,6 +130,7 @@ void MusicKWQueryArtistRequest::getDownLoadIntro(MusicResultsItem *item)
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
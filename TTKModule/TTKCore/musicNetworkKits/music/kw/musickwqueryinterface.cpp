@@ -22,13 +22,14 @@ void MusicKWQueryInterface::readFromMusicLLAttribute(MusicObject::MusicSongInfor
     const QByteArray &parameter = des.encrypt(MusicUtils::Algorithm::mdII(KW_SONG_DETAIL_DATA_URL, false).arg(info->m_songId).arg(suffix).arg(format).toUtf8(),
                                               MusicUtils::Algorithm::mdII(_SIGN, ALG_UNIMP_KEY, false).toUtf8());
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     QNetworkRequest request;
     request.setUrl(MusicUtils::Algorithm::mdII(KW_MOVIE_URL, false).arg(QString(parameter)));
     MusicObject::setSslConfiguration(&request);
 
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -219,9 +220,10 @@ void MusicKWQueryInterface::readFromMusicSongPicture(MusicObject::MusicSongInfor
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
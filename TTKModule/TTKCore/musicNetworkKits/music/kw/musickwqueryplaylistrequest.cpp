@@ -38,6 +38,7 @@ void MusicKWQueryPlaylistRequest::startToPage(int offset)
     request.setUrl(MusicUtils::Algorithm::mdII(KW_PLAYLIST_URL, false).arg(m_queryText).arg(offset).arg(m_pageSize));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     m_reply = m_manager->get(request);
     connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
@@ -59,6 +60,7 @@ void MusicKWQueryPlaylistRequest::startToSearch(const QString &playlist)
     request.setUrl(MusicUtils::Algorithm::mdII(KW_PLAYLIST_INFO_URL, false).arg(playlist));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     QNetworkReply *reply = m_manager->get(request);
     connect(reply, SIGNAL(finished()), SLOT(getDetailsFinished()));
@@ -80,9 +82,11 @@ void MusicKWQueryPlaylistRequest::getPlaylistInfo(MusicResultsItem &item)
     request.setUrl(MusicUtils::Algorithm::mdII(KW_PLAYLIST_INFO_URL, false).arg(item.m_id));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     MusicSemaphoreLoop loop;
     QNetworkReply *reply = m_manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -154,11 +158,17 @@ void MusicKWQueryPlaylistRequest::getDetailsFinished()
 
     MusicQueryPlaylistRequest::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
-        QJson::Parser parser;
         bool ok;
-        const QVariant &data = parser.parse(reply->readAll(), &ok);
+        const QVariant &data = parseJsonData(reply->readAll(), &ok);
+        TTK_NETWORK_QUERY_CHECK();
         if(ok)
         {
             QVariantMap value = data.toMap();
@@ -224,11 +234,17 @@ void MusicKWQueryPlaylistRequest::getMorePlaylistDetailsFinished()
     TTK_LOGGER_INFO(QString("%1 getMorePlaylistDetailsFinished").arg(getClassName()));
 
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
-        QJson::Parser parser;
         bool ok;
-        const QVariant &data = parser.parse(reply->readAll(), &ok);
+        const QVariant &data = parseJsonData(reply->readAll(), &ok);
+        TTK_NETWORK_QUERY_CHECK();
         if(ok)
         {
             const QVariantMap &value = data.toMap();
@@ -262,6 +278,7 @@ void MusicKWQueryPlaylistRequest::getMorePlaylistDetails(const QString &pid)
     request.setUrl(MusicUtils::Algorithm::mdII(KW_PLAYLIST_INFO_URL, false).arg(pid));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     QNetworkReply *reply = m_manager->get(request);
     connect(reply, SIGNAL(finished()), SLOT(getMorePlaylistDetailsFinished()));
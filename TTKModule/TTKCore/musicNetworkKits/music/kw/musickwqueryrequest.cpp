@@ -169,37 +169,28 @@ void MusicKWQueryRequest::downLoadFinished()
 
                     if(!m_querySimplify)
                     {
-                        TTK_NETWORK_QUERY_CHECK();
-                        readFromMusicSongPicture(&musicInfo);
-                        TTK_NETWORK_QUERY_CHECK();
                         musicInfo.m_lrcUrl = MusicUtils::Algorithm::mdII(KW_SONG_LRC_URL, false).arg(musicInfo.m_songId);
                         musicInfo.m_albumName = MusicUtils::String::illegalCharactersReplaced(value["ALBUM"].toString());
-                        readFromMusicSongAttribute(&musicInfo, value["FORMATS"].toString(), m_queryQuality, m_queryAllRecords);
-                        TTK_NETWORK_QUERY_CHECK();
 
-                        if(musicInfo.m_songAttrs.isEmpty())
+                        const QString format(value["FORMATS"].toString()), quality(m_queryQuality);
+                        const bool all = m_queryAllRecords;
+                        resolveSongAttribute(musicInfo, [format, quality, all](MusicObject::MusicSongInformation *info)
                         {
-                            continue;
-                        }
-                        //
-                        if(!findUrlFileSize(&musicInfo.m_songAttrs)) return;
-                        //
-                        MusicSearchedItem item;
-                        item.m_songName = musicInfo.m_songName;
-                        item.m_singerName = musicInfo.m_singerName;
-                        item.m_albumName = musicInfo.m_albumName;
-                        item.m_time = musicInfo.m_timeLength;
-                        item.m_type = mapQueryServerString();
-                        Q_EMIT createSearchedItem(item);
+                            MusicKWQueryInterface query;
+                            query.readFromMusicSongPicture(info);
+                            query.readFromMusicSongAttribute(info, format, quality, all);
+                        });
+                    }
+                    else
+                    {
+                        m_musicSongInfos << musicInfo;
                     }
-                    m_musicSongInfos << musicInfo;
                 }
             }
         }
     }
 
-    Q_EMIT downLoadDataChanged(QString());
-    deleteAll();
+    resolveSongAttributeFinished();
 }
 
 void MusicKWQueryRequest::singleDownLoadFinished()
@@ -208,6 +199,12 @@ void MusicKWQueryRequest::singleDownLoadFinished()
 
     MusicAbstractQueryRequest::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         QByteArray data = reply->readAll();
@@ -34,6 +34,7 @@ void MusicKWQueryToplistRequest::startToSearch(const QString &toplist)
     request.setUrl(MusicUtils::Algorithm::mdII(KW_TOPLIST_URL, false).arg(toplist));
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(KW_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     m_reply = m_manager->get(request);
     connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
@@ -47,9 +48,9 @@ void MusicKWQueryToplistRequest::downLoadFinished()
     MusicQueryToplistRequest::downLoadFinished();
     if(m_reply && m_reply->error() == QNetworkReply::NoError)
     {
-        QJson::Parser parser;
         bool ok;
-        const QVariant &data = parser.parse(m_reply->readAll(), &ok);
+        const QVariant &data = parseJsonData(m_reply->readAll(), &ok);
+        TTK_NETWORK_QUERY_CHECK();
         if(ok)
         {
             QVariantMap value = data.toMap();
@@ -22,6 +22,7 @@ void MusicQQDownLoadTextRequest::startToDownload()
             request.setRawHeader("Host", MusicUtils::Algorithm::mdII(HOST_URL, false).toUtf8());
             request.setRawHeader("Referer", MusicUtils::Algorithm::mdII(REFER_URL, false).toUtf8());
             MusicObject::setSslConfiguration(&request);
+            MusicObject::setCacheConfiguration(&request);
 
             m_reply = m_manager->get(request);
             connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
@@ -190,9 +190,10 @@ QString MusicQQQueryInterface::getMusicPath(const QString &file, const QString &
     request.setRawHeader("User-Agent", MusicUtils::Algorithm::mdII(QQ_UA_URL, ALG_UA_KEY, false).toUtf8());
     MusicObject::setSslConfiguration(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
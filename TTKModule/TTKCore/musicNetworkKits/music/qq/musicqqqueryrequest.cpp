@@ -72,6 +72,8 @@ void MusicQQQueryRequest::downLoadFinished()
     TTK_LOGGER_INFO(QString("%1 downLoadFinished").arg(getClassName()));
 
     MusicAbstractNetwork::downLoadFinished();
+    m_resolver->cancel();
+    m_sizeProbe->abort();
     if(m_reply && m_reply->error() == QNetworkReply::NoError)
     {
         QJson::Parser parser;
@@ -124,31 +126,23 @@ void MusicQQQueryRequest::downLoadFinished()
                         musicInfo.m_smallPicUrl = MusicUtils::Algorithm::mdII(QQ_SONG_PIC_URL, false).arg(musicInfo.m_albumId);
                         musicInfo.m_albumName = MusicUtils::String::illegalCharactersReplaced(value["albumname"].toString());
 
-                        TTK_NETWORK_QUERY_CHECK();
-                        readFromMusicSongAttribute(&musicInfo, value, m_queryQuality, m_queryAllRecords);
-                        TTK_NETWORK_QUERY_CHECK();
-
-                        if(musicInfo.m_songAttrs.isEmpty())
+                        const QString quality(m_queryQuality);
+                        const bool all = m_queryAllRecords;
+                        resolveSongAttribute(musicInfo, [value, quality, all](MusicObject::MusicSongInformation *info)
                         {
-                            continue;
-                        }
-                        //
-                        MusicSearchedItem item;
-                        item.m_songName = musicInfo.m_songName;
-                        item.m_singerName = musicInfo.m_singerName;
-                        item.m_albumName = musicInfo.m_albumName;
-                        item.m_time = musicInfo.m_timeLength;
-                        item.m_type = mapQueryServerString();
-                        Q_EMIT createSearchedItem(item);
+                            MusicQQQueryInterface().readFromMusicSongAttribute(info, value, quality, all);
+                        });
+                    }
+                    else
+                    {
+                        m_musicSongInfos << musicInfo;
                     }
-                    m_musicSongInfos << musicInfo;
                 }
             }
         }
     }
 
-    Q_EMIT downLoadDataChanged(QString());
-    deleteAll();
+    resolveSongAttributeFinished();
 }
 
 void MusicQQQueryRequest::singleDownLoadFinished()
@@ -157,6 +151,12 @@ void MusicQQQueryRequest::singleDownLoadFinished()
 
     MusicAbstractQueryRequest::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         QJson::Parser parser;
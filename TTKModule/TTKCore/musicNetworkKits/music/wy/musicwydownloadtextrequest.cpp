@@ -17,6 +17,7 @@ void MusicWYDownLoadTextRequest::startToDownload()
             QNetworkRequest request;
             request.setUrl(m_url);
             MusicObject::setSslConfiguration(&request);
+            MusicObject::setCacheConfiguration(&request);
 
             m_reply = m_manager->get(request);
             connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
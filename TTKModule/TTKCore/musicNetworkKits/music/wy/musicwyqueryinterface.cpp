@@ -46,9 +46,10 @@ void MusicWYQueryInterface::readFromMusicSongAttribute(MusicObject::MusicSongInf
     request.setUrl(MusicUtils::Algorithm::mdII(WY_SONG_INFO_OLD_URL, false).arg(bitrate*1000).arg(info->m_songId));
     makeTokenQueryRequest(&request);
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.get(request);
+    QNetworkReply *reply = manager->get(request);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
@@ -188,9 +189,10 @@ void MusicWYQueryInterface::readFromMusicSongAttributeNew(MusicObject::MusicSong
                       MusicUtils::Algorithm::mdII(WY_SONG_PATH_URL, false),
                       MusicUtils::Algorithm::mdII(WY_SONG_PATH_DATA_URL, false).arg(info->m_songId).arg(bitrate*1000));
 
-    QNetworkAccessManager manager;
+    QNetworkAccessManager *manager = MusicNetworkSession::instance();
     MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.post(request, parameter);
+    QNetworkReply *reply = manager->post(request, parameter);
+    MusicNetworkReplyGuard guard(reply);
     QObject::connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
     QObject::connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
     loop.exec();
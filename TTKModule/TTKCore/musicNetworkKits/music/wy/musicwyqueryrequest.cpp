@@ -132,31 +132,23 @@ void MusicWYQueryRequest::downLoadFinished()
 
                     if(!m_querySimplify)
                     {
-                        TTK_NETWORK_QUERY_CHECK();
-                        readFromMusicSongAttributeNew(&musicInfo, value, m_queryQuality, m_queryAllRecords);
-                        TTK_NETWORK_QUERY_CHECK();
-
-                        if(musicInfo.m_songAttrs.isEmpty())
+                        const QString quality(m_queryQuality);
+                        const bool all = m_queryAllRecords;
+                        resolveSongAttribute(musicInfo, [value, quality, all](MusicObject::MusicSongInformation *info)
                         {
-                            continue;
-                        }
-                        //
-                        MusicSearchedItem item;
-                        item.m_songName = musicInfo.m_songName;
-                        item.m_singerName = musicInfo.m_singerName;
-                        item.m_albumName = musicInfo.m_albumName;
-                        item.m_time = musicInfo.m_timeLength;
-                        item.m_type = mapQueryServerString();
-                        Q_EMIT createSearchedItem(item);
+                            MusicWYQueryInterface().readFromMusicSongAttributeNew(info, value, quality, all);
+                        });
+                    }
+                    else
+                    {
+                        m_musicSongInfos << musicInfo;
                     }
-                    m_musicSongInfos << musicInfo;
                 }
             }
         }
     }
 
-    Q_EMIT downLoadDataChanged(QString());
-    deleteAll();
+    resolveSongAttributeFinished();
 }
 
 void MusicWYQueryRequest::singleDownLoadFinished()
@@ -165,6 +157,12 @@ void MusicWYQueryRequest::singleDownLoadFinished()
 
     MusicAbstractQueryRequest::downLoadFinished();
     QNetworkReply *reply = TTKObject_cast(QNetworkReply*, QObject::sender());
+    if(reply)
+    {
+        ///the reply is not released with the shared session
+        reply->deleteLater();
+    }
+
     if(reply && reply->error() == QNetworkReply::NoError)
     {
         QJson::Parser parser;
@@ -36,6 +36,7 @@ void MusicWYQueryToplistRequest::startToSearch(const QString &toplist)
                       MusicUtils::Algorithm::mdII(WY_TOPLIST_DATA_URL, false).arg(toplist));
     TTK_NETWORK_MANAGER_CHECK();
     MusicObject::setSslConfiguration(&request);
+    MusicObject::setCacheConfiguration(&request);
 
     m_reply = m_manager->post(request, parameter);
     connect(m_reply, SIGNAL(finished()), SLOT(downLoadFinished()));
@@ -49,9 +50,9 @@ void MusicWYQueryToplistRequest::downLoadFinished()
     MusicQueryToplistRequest::downLoadFinished();
     if(m_reply && m_reply->error() == QNetworkReply::NoError)
     {
-        QJson::Parser parser;
         bool ok;
-        const QVariant &data = parser.parse(m_reply->readAll(), &ok);
+        const QVariant &data = parseJsonData(m_reply->readAll(), &ok);
+        TTK_NETWORK_QUERY_CHECK();
         if(ok)
         {
             QVariantMap value = data.toMap();
@@ -1,6 +1,7 @@
 #include "musicabstractdownloadrequest.h"
 #include "musicsettingmanager.h"
 #include "musicdownloadmanager.h"
+#include "musicdownloadcachemanager.h"
 #include "musicstringutils.h"
 #include "musiccoreutils.h"
 
@@ -36,6 +37,8 @@ MusicAbstractDownLoadRequest::~MusicAbstractDownLoadRequest()
         m_speedTimer.stop();
     }
     G_DOWNLOAD_MANAGER_PTR->removeNetworkMultiValue(this);
+    ///record the landed file, files out of the cache dirs are ignored
+    G_DOWNLOAD_CACHE_PTR->insert(m_savePath);
 }
 
 void MusicAbstractDownLoadRequest::deleteAll()
@@ -65,6 +68,11 @@ void MusicAbstractDownLoadRequest::replyError(QNetworkReply::NetworkError)
 #ifndef QT_NO_SSL
 void MusicAbstractDownLoadRequest::sslErrors(QNetworkReply* reply, const QList<QSslError> &errors)
 {
+    if(reply != m_reply)
+    {
+        return;
+    }
+
     sslErrorsString(reply, errors);
     Q_EMIT downLoadDataChanged("The file create failed");
     deleteAll();
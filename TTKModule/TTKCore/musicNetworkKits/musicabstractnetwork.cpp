@@ -6,7 +6,7 @@ MusicAbstractNetwork::MusicAbstractNetwork(QObject *parent)
     m_interrupt = false;
     m_stateCode = MusicObject::NetworkQuery;
     m_reply = nullptr;
-    m_manager = new QNetworkAccessManager(this);
+    m_manager = MusicNetworkSession::instance();
 #ifndef QT_NO_SSL
     connect(m_manager, SIGNAL(sslErrors(QNetworkReply*,QList<QSslError>)), SLOT(sslErrors(QNetworkReply*,QList<QSslError>)));
 #endif
@@ -18,11 +18,7 @@ MusicAbstractNetwork::~MusicAbstractNetwork()
     m_stateCode = MusicObject::NetworkError;
 
     deleteAll();
-    if(m_manager)
-    {
-        m_manager->deleteLater();
-        m_manager = nullptr;
-    }
+    m_manager = nullptr;
 }
 
 void MusicAbstractNetwork::deleteAll()
@@ -50,6 +46,12 @@ void MusicAbstractNetwork::replyError(QNetworkReply::NetworkError)
 #ifndef QT_NO_SSL
 void MusicAbstractNetwork::sslErrors(QNetworkReply* reply, const QList<QSslError> &errors)
 {
+    ///the manager is shared, only handle the reply of this request
+    if(reply != m_reply)
+    {
+        return;
+    }
+
     sslErrorsString(reply, errors);
     Q_EMIT downLoadDataChanged(QString());
     deleteAll();
@@ -86,4 +88,9 @@ void setSslConfiguration(QNetworkRequest *request, QSslSocket::PeerVerifyMode mo
     Q_UNUSED(mode);
 #endif
 }
+
+void setCacheConfiguration(QNetworkRequest *request)
+{
+    request->setAttribute(QNetworkRequest::Attribute(MusicNetworkCache::CacheAttribute), true);
+}
 }
@@ -19,11 +19,14 @@
  * with this program; If not, see <http://www.gnu.org/licenses/>.
  ================================================= */
 
+#include <QPointer>
 #include <QNetworkReply>
 #include <QSslConfiguration>
 
 #include "musictime.h"
 #include "musicnetworkthread.h"
+#include "musicnetworkcache.h"
+#include "musicnetworksession.h"
 #include "musicnetworkdefines.h"
 #include "musicalgorithmutils.h"
 #include "qjson/parser.h"
@@ -91,7 +94,7 @@ protected:
     QVariantMap m_rawData;
     volatile bool m_interrupt;
     volatile MusicObject::NetworkCode m_stateCode;
-    QNetworkReply *m_reply;
+    QPointer<QNetworkReply> m_reply;
     QNetworkAccessManager *m_manager;
 
 };
@@ -109,6 +112,10 @@ namespace MusicObject
      * Set request ssl configuration.
      */
     TTK_MODULE_EXPORT void setSslConfiguration(QNetworkRequest *request, QSslSocket::PeerVerifyMode mode = QSslSocket::VerifyNone);
+    /*!
+     * Set request response cache enabled.
+     */
+    TTK_MODULE_EXPORT void setCacheConfiguration(QNetworkRequest *request);
 
 }
 
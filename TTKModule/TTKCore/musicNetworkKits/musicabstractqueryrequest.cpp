@@ -2,6 +2,11 @@
 #include "musicsemaphoreloop.h"
 #include "musicnumberutils.h"
 
+#include <QThreadPool>
+#include "qjson/parserrunnable.h"
+
+#define QUERY_JSON_THREAD_SIZE  (256 * MH_KB2B)
+
 MusicAbstractQueryRequest::MusicAbstractQueryRequest(QObject *parent)
     : MusicPagingRequest(parent)
 {
@@ -9,6 +14,14 @@ MusicAbstractQueryRequest::MusicAbstractQueryRequest(QObject *parent)
     m_querySimplify = false;
     m_queryQuality = tr("SD");
     m_queryServer = "Invalid";
+    m_jsonParsed = false;
+
+    m_resolver = new MusicSongAttributeResolver(this);
+    connect(m_resolver, SIGNAL(resolved(MusicObject::MusicSongInformation)), SLOT(songAttributeResolved(MusicObject::MusicSongInformation)));
+    connect(m_resolver, SIGNAL(finished()), SLOT(songAttributeFinished()));
+
+    m_sizeProbe = new MusicUrlSizeProbe(this);
+    connect(m_sizeProbe, SIGNAL(sizeChanged(QString,qint64)), SLOT(urlFileSizeChanged(QString,qint64)));
 }
 
 void MusicAbstractQueryRequest::startToSingleSearch(const QString &text)
@@ -36,42 +49,97 @@ QString MusicAbstractQueryRequest::mapQueryServerString() const
 qint64 MusicAbstractQueryRequest::getUrlFileSize(const QString &url)
 {
     qint64 size = -1;
-
-    QNetworkAccessManager manager;
-    QNetworkRequest request;
-    request.setUrl(url);
-    MusicObject::setSslConfiguration(&request);
-
-    MusicSemaphoreLoop loop;
-    QNetworkReply *reply = manager.head(request);
-    connect(reply, SIGNAL(finished()), &loop, SLOT(quit()));
-    connect(reply, SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
-    loop.exec();
-
-    if(!reply || reply->error() != QNetworkReply::NoError)
+    if(MusicUrlSizeProbe::findCache(url, &size))
     {
         return size;
     }
 
-    size = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
-    const QVariant &redirection = reply->attribute(QNetworkRequest::RedirectionTargetAttribute);
-    if(!redirection.isNull())
+    MusicUrlSizeProbe probe;
+    MusicSemaphoreLoop loop;
+    connect(&probe, SIGNAL(finished()), &loop, SLOT(quit()));
+    probe.probe(QStringList() << url);
+    if(probe.isRunning())
     {
-        size = getUrlFileSize(redirection.toString());
+        loop.exec();
     }
 
-    reply->deleteLater();
-
+    ///failed probe is not cached
+    MusicUrlSizeProbe::findCache(url, &size);
     return size;
 }
 
 void MusicAbstractQueryRequest::downLoadFinished()
 {
+    m_resolver->cancel();
+    m_sizeProbe->abort();
     Q_EMIT clearAllItems();
     m_musicSongInfos.clear();
     MusicPagingRequest::downLoadFinished();
 }
 
+void MusicAbstractQueryRequest::songAttributeResolved(const MusicObject::MusicSongInformation &info)
+{
+    if(m_interrupt || info.m_songAttrs.isEmpty())
+    {
+        return;
+    }
+
+    MusicSearchedItem item;
+    item.m_songName = info.m_songName;
+    item.m_singerName = info.m_singerName;
+    item.m_albumName = info.m_albumName;
+    item.m_time = info.m_timeLength;
+    item.m_type = mapQueryServerString();
+    Q_EMIT createSearchedItem(item);
+
+    MusicObject::MusicSongInformation song(info);
+    findUrlFileSize(&song.m_songAttrs);
+    m_musicSongInfos << song;
+}
+
+void MusicAbstractQueryRequest::songAttributeFinished()
+{
+    if(m_interrupt)
+    {
+        return;
+    }
+
+    Q_EMIT downLoadDataChanged(QString());
+    deleteAll();
+}
+
+void MusicAbstractQueryRequest::urlFileSizeChanged(const QString &url, qint64 size)
+{
+    const QString &label = MusicUtils::Number::size2Label(size);
+    for(MusicObject::MusicSongInformation &info : m_musicSongInfos)
+    {
+        for(MusicObject::MusicSongAttribute &attr : info.m_songAttrs)
+        {
+            if(attr.m_url == url && (attr.m_size.isEmpty() || attr.m_size == STRING_NULL))
+            {
+                attr.m_size = label;
+            }
+        }
+    }
+    Q_EMIT urlFileSizeProbed(url, size);
+}
+
+void MusicAbstractQueryRequest::jsonParsingFinished(const QVariant &data, bool ok)
+{
+    m_jsonData = data;
+    m_jsonParsed = ok;
+}
+
+void MusicAbstractQueryRequest::resolveSongAttribute(const MusicObject::MusicSongInformation &info, const MusicSongAttributeFunction &function)
+{
+    m_resolver->append(info, function);
+}
+
+void MusicAbstractQueryRequest::resolveSongAttributeFinished()
+{
+    m_resolver->finish();
+}
+
 QString MusicAbstractQueryRequest::findTimeStringByAttrs(const MusicObject::MusicSongAttributes &attrs)
 {
     for(const MusicObject::MusicSongAttribute &attr : qAsConst(attrs))
@@ -99,13 +167,51 @@ bool MusicAbstractQueryRequest::findUrlFileSize(MusicObject::MusicSongAttribute
 
 bool MusicAbstractQueryRequest::findUrlFileSize(MusicObject::MusicSongAttributes *attrs)
 {
-    for(int i=0; i<attrs->count(); ++i)
+    TTK_NETWORK_QUERY_CHECK(false);
+    QStringList urls;
+    for(MusicObject::MusicSongAttribute &attr : *attrs)
     {
-        if(!findUrlFileSize(&(*attrs)[i]))
+        qint64 size = -1;
+        if(!attr.m_size.isEmpty() && attr.m_size != STRING_NULL)
         {
-            return false;
+            continue;
+        }
+        else if(MusicUrlSizeProbe::findCache(attr.m_url, &size))
+        {
+            attr.m_size = MusicUtils::Number::size2Label(size);
+        }
+        else
+        {
+            urls << attr.m_url;
         }
     }
 
+    ///the song is shown at once, sizes are filled in when probed
+    m_sizeProbe->probe(urls);
     return true;
 }
+
+QVariant MusicAbstractQueryRequest::parseJsonData(const QByteArray &bytes, bool *ok)
+{
+    if(bytes.size() < QUERY_JSON_THREAD_SIZE)
+    {
+        QJson::Parser parser;
+        return parser.parse(bytes, ok);
+    }
+
+    ///large toplist and playlist responses are parsed off the gui thread
+    m_jsonData.clear();
+    m_jsonParsed = false;
+
+    QJson::ParserRunnable *runnable = new QJson::ParserRunnable;
+    runnable->setData(bytes);
+
+    QEventLoop loop;
+    connect(runnable, SIGNAL(parsingFinished(QVariant,bool,QString)), this, SLOT(jsonParsingFinished(QVariant,bool)), Qt::QueuedConnection);
+    connect(runnable, SIGNAL(parsingFinished(QVariant,bool,QString)), &loop, SLOT(quit()), Qt::QueuedConnection);
+    QThreadPool::globalInstance()->start(runnable);
+    loop.exec();
+
+    *ok = m_jsonParsed;
+    return m_jsonData;
+}
@@ -22,6 +22,8 @@
 #include "musicobject.h"
 #include "musicstringutils.h"
 #include "musicpagingrequest.h"
+#include "musicurlsizeprobe.h"
+#include "musicsongattributeresolver.h"
 
 /*! @brief The class of the searched data item.
  * @author Greedysky <greedysky@163.com>
@@ -89,7 +91,8 @@ enum DownloadQueryServer
     WYQueryServer,
     QQQueryServer,
     KWQueryServer,
-    KGQueryServer
+    KGQueryServer,
+    FederatedQueryServer
 };
 
 /*! @brief The class of abstract query download data from net.
@@ -197,6 +200,10 @@ Q_SIGNALS:
      * Create the current items by song name\ artist name and time.
      */
     void createSearchedItem(const MusicSearchedItem &songItem);
+    /*!
+     * Url file size of song attribute probed.
+     */
+    void urlFileSizeProbed(const QString &url, qint64 size);
 
 public Q_SLOTS:
     /*!
@@ -204,7 +211,33 @@ public Q_SLOTS:
      */
     virtual void downLoadFinished() override;
 
+private Q_SLOTS:
+    /*!
+     * Song attributes resolved, create searched item.
+     */
+    void songAttributeResolved(const MusicObject::MusicSongInformation &info);
+    /*!
+     * All song attributes resolved.
+     */
+    void songAttributeFinished();
+    /*!
+     * Url file size probed, fill the size of song attributes.
+     */
+    void urlFileSizeChanged(const QString &url, qint64 size);
+    /*!
+     * Json data parsed in the thread pool.
+     */
+    void jsonParsingFinished(const QVariant &data, bool ok);
+
 protected:
+    /*!
+     * Resolve song attributes in worker threads, item is created when resolved.
+     */
+    void resolveSongAttribute(const MusicObject::MusicSongInformation &info, const MusicSongAttributeFunction &function);
+    /*!
+     * No more song to resolve, data changed is emitted when all resolved.
+     */
+    void resolveSongAttributeFinished();
     /*!
      * Find time string by attrs.
      */
@@ -214,15 +247,23 @@ protected:
      */
     bool findUrlFileSize(MusicObject::MusicSongAttribute *attr);
     /*!
-     * Find download file size.
+     * Find download file size, uncached sizes are probed in background.
      */
     bool findUrlFileSize(MusicObject::MusicSongAttributes *attrs);
+    /*!
+     * Parse json data, large data is parsed in the thread pool.
+     */
+    QVariant parseJsonData(const QByteArray &bytes, bool *ok);
 
     MusicObject::MusicSongInformations m_musicSongInfos;
     QString m_queryText, m_queryQuality;
     QString m_queryServer;
     QueryType m_currentType;
     bool m_queryAllRecords, m_querySimplify;
+    MusicSongAttributeResolver *m_resolver;
+    MusicUrlSizeProbe *m_sizeProbe;
+    QVariant m_jsonData;
+    bool m_jsonParsed;
 
 };
 
@@ -5,6 +5,7 @@
 #include "musickgqueryrequest.h"
 #include "musickwqueryrequest.h"
 #include "musicqqqueryrequest.h"
+#include "musicfederatedqueryrequest.h"
 //
 #include "musicwyquerymovierequest.h"
 #include "musickgquerymovierequest.h"
@@ -85,6 +86,7 @@ MusicAbstractQueryRequest *MusicDownLoadQueryFactory::getQueryRequest(QObject *p
         case QQQueryServer:  request = new MusicQQQueryRequest(parent); break;
         case KWQueryServer:  request = new MusicKWQueryRequest(parent); break;
         case KGQueryServer:  request = new MusicKGQueryRequest(parent); break;
+        case FederatedQueryServer: request = new MusicFederatedQueryRequest(parent); break;
         default: request = new MusicWYQueryRequest(parent);
     }
     TTK_LOGGER_INFO(QString("MusicQueryrequest server: %1").arg(request->getQueryServer()));
@@ -295,10 +297,9 @@ MusicTranslationRequest *MusicDownLoadQueryFactory::getTranslationRequest(QObjec
     return request;
 }
 
-MusicAbstractDownLoadRequest *MusicDownLoadQueryFactory::getDownloadSmallPictureRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent)
+MusicAbstractDownLoadRequest *MusicDownLoadQueryFactory::getDownloadSmallPictureRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent, const QString &server)
 {
-    const int index = G_SETTING_PTR->value(MusicSettingManager::DownloadServer).toInt();
-    switch(TTKStatic_cast(DownloadQueryServer, index))
+    switch(mapQueryServer(server))
     {
         case WYQueryServer: return (new MusicDownloadDataRequest(url, save, type, parent));
         case QQQueryServer: return (new MusicDownloadDataRequest(url, save, type, parent));
@@ -309,10 +310,9 @@ MusicAbstractDownLoadRequest *MusicDownLoadQueryFactory::getDownloadSmallPicture
     return (new MusicDownloadDataRequest(url, save, type, parent));
 }
 
-MusicAbstractDownLoadRequest *MusicDownLoadQueryFactory::getDownloadLrcRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent)
+MusicAbstractDownLoadRequest *MusicDownLoadQueryFactory::getDownloadLrcRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent, const QString &server)
 {
-    const int index = G_SETTING_PTR->value(MusicSettingManager::DownloadServer).toInt();
-    switch(TTKStatic_cast(DownloadQueryServer, index))
+    switch(mapQueryServer(server))
     {
         case WYQueryServer: return (new MusicWYDownLoadTextRequest(url, save, type, parent));
         case QQQueryServer: return (new MusicQQDownLoadTextRequest(url, save, type, parent));
@@ -335,3 +335,17 @@ MusicDownloadBackgroundRequest *MusicDownLoadQueryFactory::getDownloadBigPicture
         return (new MusicKWDownloadBackgroundRequest(name, save, parent));
     }
 }
+
+DownloadQueryServer MusicDownLoadQueryFactory::mapQueryServer(const QString &server) const
+{
+    if(server == QUERY_WY_INTERFACE)
+        return WYQueryServer;
+    else if(server == QUERY_QQ_INTERFACE)
+        return QQQueryServer;
+    else if(server == QUERY_KW_INTERFACE)
+        return KWQueryServer;
+    else if(server == QUERY_KG_INTERFACE)
+        return KGQueryServer;
+    else
+        return TTKStatic_cast(DownloadQueryServer, G_SETTING_PTR->value(MusicSettingManager::DownloadServer).toInt());
+}
@@ -101,18 +101,25 @@ public:
 
     /*!
      * Get download small picture object by type.
+     * The song source server is used when given, otherwise the setting one.
      */
-    MusicAbstractDownLoadRequest *getDownloadSmallPictureRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent = nullptr);
+    MusicAbstractDownLoadRequest *getDownloadSmallPictureRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent = nullptr, const QString &server = QString());
     /*!
      * Get download lrc object by type.
+     * The song source server is used when given, otherwise the setting one.
      */
-    MusicAbstractDownLoadRequest *getDownloadLrcRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent = nullptr);
+    MusicAbstractDownLoadRequest *getDownloadLrcRequest(const QString &url, const QString &save, MusicObject::DownloadType type, QObject *parent = nullptr, const QString &server = QString());
     /*!
      * Get download big picture object by type.
      */
     MusicDownloadBackgroundRequest *getDownloadBigPictureRequest(const QString &name, const QString &save, QObject *parent = nullptr);
 
 protected:
+    /*!
+     * Map the song source server name to server type.
+     */
+    DownloadQueryServer mapQueryServer(const QString &server) const;
+
     DECLARE_SINGLETON_CLASS(MusicDownLoadQueryFactory)
 
 };
@@ -0,0 +1,246 @@
+#include "musicfederatedqueryrequest.h"
+#include "musicwyqueryrequest.h"
+#include "musicqqqueryrequest.h"
+#include "musickwqueryrequest.h"
+#include "musickgqueryrequest.h"
+
+#include <algorithm>
+
+#define DURATION_TOLERANCE      (3 * MT_S2MS)
+
+static QString songNameKey(const MusicObject::MusicSongInformation &info)
+{
+    ///case, space and punctuation differ between servers
+    QString key;
+    const QString &text = (info.m_singerName + info.m_songName).toLower();
+    for(const QChar &c : qAsConst(text))
+    {
+        if(c.isLetterOrNumber())
+        {
+            key.append(c);
+        }
+    }
+    return key;
+}
+
+static bool songDurationEqual(const MusicObject::MusicSongInformation &a, const MusicObject::MusicSongInformation &b)
+{
+    const qint64 ta = MusicTime::labelJustified2MsecTime(a.m_timeLength);
+    const qint64 tb = MusicTime::labelJustified2MsecTime(b.m_timeLength);
+    ///unknown duration matches any
+    return ta <= 0 || tb <= 0 || qAbs(ta - tb) <= DURATION_TOLERANCE;
+}
+
+static int songQualityScore(const MusicObject::MusicSongInformation &info)
+{
+    int bitrate = 0;
+    for(const MusicObject::MusicSongAttribute &attr : qAsConst(info.m_songAttrs))
+    {
+        bitrate = qMax(bitrate, attr.m_bitrate);
+    }
+    return bitrate * 16 + info.m_songAttrs.count();
+}
+
+
+MusicFederatedQueryRequest::MusicFederatedQueryRequest(QObject *parent)
+    : MusicAbstractQueryRequest(parent)
+{
+    m_queryServer = "Federated";
+
+    m_requests << new MusicWYQueryRequest(this);
+    m_requests << new MusicQQQueryRequest(this);
+    m_requests << new MusicKWQueryRequest(this);
+    m_requests << new MusicKGQueryRequest(this);
+
+    for(MusicAbstractQueryRequest *request : qAsConst(m_requests))
+    {
+        m_pageSize += request->getPageSize();
+        connect(request, SIGNAL(downLoadDataChanged(QString)), SLOT(queryDataChanged()));
+        ///sizes probed by the server request after its songs are merged
+        connect(request, SIGNAL(urlFileSizeProbed(QString,qint64)), SLOT(urlFileSizeChanged(QString,qint64)));
+    }
+}
+
+void MusicFederatedQueryRequest::startToSearch(QueryType type, const QString &text)
+{
+    if(!m_manager)
+    {
+        return;
+    }
+
+    TTK_LOGGER_INFO(QString("%1 startToSearch %2").arg(getClassName()).arg(text));
+
+    m_currentType = type;
+    m_queryText = text.trimmed();
+
+    startToPage(0);
+}
+
+void MusicFederatedQueryRequest::startToPage(int offset)
+{
+    if(!m_manager)
+    {
+        return;
+    }
+
+    TTK_LOGGER_INFO(QString("%1 startToPage %2").arg(getClassName()).arg(offset));
+
+    MusicAbstractQueryRequest::downLoadFinished();
+    m_queryServers.clear();
+    m_totalSize = 0;
+    m_pageIndex = offset;
+
+    initRequests();
+    m_pendings = m_requests;
+
+    ///all servers are queried at once, results are shown as each one answers
+    for(MusicAbstractQueryRequest *request : qAsConst(m_requests))
+    {
+        if(offset == 0)
+        {
+            request->startToSearch(m_currentType, m_queryText);
+        }
+        else
+        {
+            request->startToPage(offset);
+        }
+    }
+}
+
+void MusicFederatedQueryRequest::startToSingleSearch(const QString &text)
+{
+    if(!m_manager)
+    {
+        return;
+    }
+
+    TTK_LOGGER_INFO(QString("%1 startToSingleSearch %2").arg(getClassName()).arg(text));
+
+    MusicAbstractQueryRequest::downLoadFinished();
+    m_queryServers.clear();
+
+    initRequests();
+    ///song id belongs to one server, use the default one
+    MusicAbstractQueryRequest *request = m_requests.first();
+    m_pendings.clear();
+    m_pendings << request;
+    request->startToSingleSearch(text);
+}
+
+void MusicFederatedQueryRequest::queryDataChanged()
+{
+    MusicAbstractQueryRequest *request = TTKObject_cast(MusicAbstractQueryRequest*, QObject::sender());
+    if(m_interrupt || !request || !m_pendings.removeOne(request))
+    {
+        return;
+    }
+
+    m_totalSize += request->getTotalSize();
+    if(mergeSongInfos(request) && !m_querySimplify)
+    {
+        createSearchedItems();
+    }
+
+    if(m_pendings.isEmpty())
+    {
+        Q_EMIT downLoadDataChanged(QString());
+        deleteAll();
+    }
+}
+
+void MusicFederatedQueryRequest::initRequests()
+{
+    for(MusicAbstractQueryRequest *request : qAsConst(m_requests))
+    {
+        request->setQueryQuality(m_queryQuality);
+        request->setQueryAllRecords(m_queryAllRecords);
+        request->setQuerySimplify(m_querySimplify);
+    }
+}
+
+bool MusicFederatedQueryRequest::mergeSongInfos(MusicAbstractQueryRequest *request)
+{
+    const MusicObject::MusicSongInformations &infos = request->getMusicSongInfos();
+    if(infos.isEmpty())
+    {
+        return false;
+    }
+
+    QStringList keys;
+    for(const MusicObject::MusicSongInformation &info : qAsConst(m_musicSongInfos))
+    {
+        keys << songNameKey(info);
+    }
+
+    const QString &server = request->mapQueryServerString();
+    for(const MusicObject::MusicSongInformation &info : qAsConst(infos))
+    {
+        const QString &key = songNameKey(info);
+        int index = -1;
+        for(int i = 0; i < keys.count(); ++i)
+        {
+            if(keys[i] == key && songDurationEqual(m_musicSongInfos[i], info))
+            {
+                index = i;
+                break;
+            }
+        }
+
+        MusicObject::MusicSongInformation song(info);
+        ///file sizes are already probed by the server request
+        song.m_queryServer = request->getQueryServer();
+
+        if(index == -1)
+        {
+            keys << key;
+            m_musicSongInfos << song;
+            m_queryServers << server;
+        }
+        else if(songQualityScore(song) > songQualityScore(m_musicSongInfos[index]))
+        {
+            ///duplicate song is kept from the server with better quality
+            m_musicSongInfos[index] = song;
+            m_queryServers[index] = server;
+        }
+    }
+
+    QList<int> scores, indexes;
+    for(int i = 0; i < m_musicSongInfos.count(); ++i)
+    {
+        scores << songQualityScore(m_musicSongInfos[i]);
+        indexes << i;
+    }
+
+    std::stable_sort(indexes.begin(), indexes.end(), [&scores](int a, int b)
+    {
+        return scores[a] > scores[b];
+    });
+
+    MusicObject::MusicSongInformations songInfos;
+    QStringList queryServers;
+    for(int index : qAsConst(indexes))
+    {
+        songInfos << m_musicSongInfos[index];
+        queryServers << m_queryServers[index];
+    }
+
+    m_musicSongInfos = songInfos;
+    m_queryServers = queryServers;
+    return true;
+}
+
+void MusicFederatedQueryRequest::createSearchedItems()
+{
+    Q_EMIT clearAllItems();
+    for(int i = 0; i < m_musicSongInfos.count(); ++i)
+    {
+        const MusicObject::MusicSongInformation &info = m_musicSongInfos[i];
+        MusicSearchedItem item;
+        item.m_songName = info.m_songName;
+        item.m_singerName = info.m_singerName;
+        item.m_albumName = info.m_albumName;
+        item.m_time = info.m_timeLength;
+        item.m_type = m_queryServers[i];
+        Q_EMIT createSearchedItem(item);
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef MUSICFEDERATEDQUERYREQUEST_H
+#define MUSICFEDERATEDQUERYREQUEST_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include "musicabstractqueryrequest.h"
+
+/*! @brief The class of federated query download data from all servers.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicFederatedQueryRequest : public MusicAbstractQueryRequest
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicFederatedQueryRequest)
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicFederatedQueryRequest(QObject *parent = nullptr);
+
+    /*!
+     * Start to search data from name and type.
+     */
+    virtual void startToSearch(QueryType type, const QString &text) override;
+    /*!
+     * Start to search data from name and type bt paging.
+     */
+    virtual void startToPage(int offset) override;
+
+    /*!
+     * Start to search data by given id.
+     */
+    virtual void startToSingleSearch(const QString &text) override;
+
+private Q_SLOTS:
+    /*!
+     * One of the server query finished, merge its results.
+     */
+    void queryDataChanged();
+
+private:
+    /*!
+     * Forward query settings to all server requests.
+     */
+    void initRequests();
+    /*!
+     * Merge the song results of the server request.
+     */
+    bool mergeSongInfos(MusicAbstractQueryRequest *request);
+    /*!
+     * Create searched items by merged results.
+     */
+    void createSearchedItems();
+
+    QList<MusicAbstractQueryRequest*> m_requests;
+    QList<MusicAbstractQueryRequest*> m_pendings;
+    QStringList m_queryServers;
+
+};
+
+#endif // MUSICFEDERATEDQUERYREQUEST_H
@@ -0,0 +1,158 @@
+#include "musicsongattributeresolver.h"
+
+#include <QThreadPool>
+
+#define RESOLVE_MAX_COUNT   8
+
+/*! @brief The class of the song attribute resolve state.
+ * Shared between resolver and runnables, the target is cleared on cancel.
+ * @author Greedysky <greedysky@163.com>
+ */
+class MusicSongAttributeResolveState
+{
+public:
+    MusicSongAttributeResolveState(QObject *target)
+        : m_target(target)
+    {
+
+    }
+
+    QMutex m_mutex;
+    QObject *m_target;
+    QList< QPair<int, MusicObject::MusicSongInformation> > m_results;
+
+};
+
+static QThreadPool *resolvePool()
+{
+    static QThreadPool pool;
+    pool.setMaxThreadCount(RESOLVE_MAX_COUNT * 2);
+    return &pool;
+}
+
+
+MusicSongAttributeResolveRunnable::MusicSongAttributeResolveRunnable(const QSharedPointer<MusicSongAttributeResolveState> &state,
+                                                                     int index,
+                                                                     const MusicObject::MusicSongInformation &info,
+                                                                     const MusicSongAttributeFunction &function)
+    : QRunnable()
+    , m_state(state)
+    , m_index(index)
+    , m_info(info)
+    , m_function(function)
+{
+    setAutoDelete(true);
+}
+
+void MusicSongAttributeResolveRunnable::run()
+{
+    m_state->m_mutex.lock();
+    const bool canceled = !m_state->m_target;
+    m_state->m_mutex.unlock();
+
+    if(canceled)
+    {
+        return;
+    }
+
+    m_function(&m_info);
+
+    QMutexLocker locker(&m_state->m_mutex);
+    if(m_state->m_target)
+    {
+        m_state->m_results << qMakePair(m_index, m_info);
+        QMetaObject::invokeMethod(m_state->m_target, "resultReady", Qt::QueuedConnection);
+    }
+}
+
+
+
+MusicSongAttributeResolver::MusicSongAttributeResolver(QObject *parent)
+    : QObject(parent)
+{
+    m_running = 0;
+    m_appendIndex = 0;
+    m_emitIndex = 0;
+    m_finishing = false;
+    m_state = QSharedPointer<MusicSongAttributeResolveState>(new MusicSongAttributeResolveState(this));
+}
+
+MusicSongAttributeResolver::~MusicSongAttributeResolver()
+{
+    cancel();
+}
+
+void MusicSongAttributeResolver::append(const MusicObject::MusicSongInformation &info, const MusicSongAttributeFunction &function)
+{
+    m_pending << qMakePair(info, function);
+    startToResolve();
+}
+
+void MusicSongAttributeResolver::finish()
+{
+    m_finishing = true;
+    startToResolve();
+}
+
+void MusicSongAttributeResolver::cancel()
+{
+    m_state->m_mutex.lock();
+    m_state->m_target = nullptr;
+    m_state->m_results.clear();
+    m_state->m_mutex.unlock();
+
+    ///runnables in flight keep the old state and drop their results
+    m_state = QSharedPointer<MusicSongAttributeResolveState>(new MusicSongAttributeResolveState(this));
+    m_pending.clear();
+    m_ready.clear();
+    m_running = 0;
+    m_appendIndex = 0;
+    m_emitIndex = 0;
+    m_finishing = false;
+}
+
+void MusicSongAttributeResolver::resultReady()
+{
+    m_state->m_mutex.lock();
+    const QList< QPair<int, MusicObject::MusicSongInformation> > results(m_state->m_results);
+    m_state->m_results.clear();
+    m_state->m_mutex.unlock();
+
+    for(const auto &result : qAsConst(results))
+    {
+        --m_running;
+        m_ready.insert(result.first, result.second);
+    }
+
+    ///only the contiguous prefix is emitted, later results wait for earlier ones
+    const QSharedPointer<MusicSongAttributeResolveState> state(m_state);
+    while(!m_ready.isEmpty() && m_ready.constBegin().key() == m_emitIndex)
+    {
+        const MusicObject::MusicSongInformation info(m_ready.take(m_emitIndex++));
+        Q_EMIT resolved(info);
+
+        if(state != m_state)
+        {
+            ///canceled by receiver
+            return;
+        }
+    }
+
+    startToResolve();
+}
+
+void MusicSongAttributeResolver::startToResolve()
+{
+    while(m_running < RESOLVE_MAX_COUNT && !m_pending.isEmpty())
+    {
+        const QPair<MusicObject::MusicSongInformation, MusicSongAttributeFunction> &item = m_pending.takeFirst();
+        ++m_running;
+        resolvePool()->start(new MusicSongAttributeResolveRunnable(m_state, m_appendIndex++, item.first, item.second));
+    }
+
+    if(m_finishing && m_running == 0 && m_pending.isEmpty())
+    {
+        m_finishing = false;
+        Q_EMIT finished();
+    }
+}
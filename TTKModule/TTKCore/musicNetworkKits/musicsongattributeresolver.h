@@ -0,0 +1,128 @@
+#ifndef MUSICSONGATTRIBUTERESOLVER_H
+#define MUSICSONGATTRIBUTERESOLVER_H
+
+/* =================================================
+ * This file is part of the TTK Music Player project
+ * Copyright (C) 2015 - 2021 Greedysky Studio
+
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License along
+ * with this program; If not, see <http://www.gnu.org/licenses/>.
+ ================================================= */
+
+#include <QMap>
+#include <QMutex>
+#include <QRunnable>
+#include <functional>
+#include <QSharedPointer>
+#include "musicobject.h"
+#include "musicglobaldefine.h"
+
+/*! Resolve song attributes(size\bitrate\url) by the given info. */
+typedef std::function<void(MusicObject::MusicSongInformation*)> MusicSongAttributeFunction;
+
+class MusicSongAttributeResolveState;
+
+/*! @brief The class of the song attribute resolve runnable.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongAttributeResolveRunnable : public QRunnable
+{
+public:
+    /*!
+     * Object contsructor.
+     */
+    MusicSongAttributeResolveRunnable(const QSharedPointer<MusicSongAttributeResolveState> &state,
+                                      int index,
+                                      const MusicObject::MusicSongInformation &info,
+                                      const MusicSongAttributeFunction &function);
+
+    /*!
+     * Runnable run now.
+     */
+    virtual void run() override;
+
+protected:
+    QSharedPointer<MusicSongAttributeResolveState> m_state;
+    int m_index;
+    MusicObject::MusicSongInformation m_info;
+    MusicSongAttributeFunction m_function;
+
+};
+
+
+/*! @brief The class of the song attribute resolver.
+ * Resolves song attributes in a worker pool with a bounded in-flight count,
+ * results are emitted in the GUI thread in the order they were appended.
+ * @author Greedysky <greedysky@163.com>
+ */
+class TTK_MODULE_EXPORT MusicSongAttributeResolver : public QObject
+{
+    Q_OBJECT
+    TTK_DECLARE_MODULE(MusicSongAttributeResolver)
+public:
+    /*!
+     * Object contsructor.
+     */
+    explicit MusicSongAttributeResolver(QObject *parent = nullptr);
+    ~MusicSongAttributeResolver();
+
+    /*!
+     * Append song info to be resolved.
+     */
+    void append(const MusicObject::MusicSongInformation &info, const MusicSongAttributeFunction &function);
+    /*!
+     * No more song info will be appended, finished is emitted when all resolved.
+     */
+    void finish();
+    /*!
+     * Check resolver is running.
+     */
+    inline bool isRunning() const { return m_running > 0 || !m_pending.isEmpty(); }
+
+Q_SIGNALS:
+    /*!
+     * Song attributes resolved.
+     */
+    void resolved(const MusicObject::MusicSongInformation &info);
+    /*!
+     * All song infos resolved.
+     */
+    void finished();
+
+public Q_SLOTS:
+    /*!
+     * Cancel current resolving, results in flight are dropped.
+     */
+    void cancel();
+
+private Q_SLOTS:
+    /*!
+     * Emit resolved results.
+     */
+    void resultReady();
+
+private:
+    /*!
+     * Start pending infos up to max in-flight count.
+     */
+    void startToResolve();
+
+    QSharedPointer<MusicSongAttributeResolveState> m_state;
+    QList< QPair<MusicObject::MusicSongInformation, MusicSongAttributeFunction> > m_pending;
+    QMap<int, MusicObject::MusicSongInformation> m_ready;
+    int m_running, m_appendIndex, m_emitIndex;
+    bool m_finishing;
+
+};
+
+#endif // MUSICSONGATTRIBUTERESOLVER_H
@@ -12,33 +12,35 @@ bool MusicASXConfigManager::readPlaylistData(MusicSongItems &items)
     MusicSongItem item;
     item.m_itemName = QFileInfo(m_file->fileName()).baseName();
 
-    MusicXmlNodeHelper nodeHelper(m_document->documentElement());
-    nodeHelper.load();
-
-    const QDomNodeList &itemNodes = m_document->elementsByTagName(nodeHelper.nodeName("Entry"));
-    for(int i=0; i<itemNodes.count(); ++i)
+    ///entry params are collected until the next entry starts
+    bool entry = false;
+    QString duration, path;
+    while(true)
     {
-        const QDomNode &node = itemNodes.at(i);
-        const QDomNodeList &paramNodes = node.childNodes();
-
-        QString duration, path;
-        for(int j=0; j<paramNodes.count(); ++j)
+        const bool hasNext = readStreamElement();
+        if(!hasNext || isStreamElement("Entry"))
         {
-            const QDomNode &paramNode = paramNodes.at(j);
-            if(paramNode.nodeName().toLower() == "duration")
+            if(!path.isEmpty())
             {
-                duration = paramNode.toElement().attribute("value");
-                duration = duration.mid(3, 5);
+                item.m_songs << MusicSong(path, 0, duration, QString());
             }
-            else if(paramNode.nodeName().toLower() == "ref")
+
+            if(!hasNext)
             {
-                path = paramNode.toElement().attribute("href");
+                break;
             }
-        }
 
-        if(!path.isEmpty())
+            entry = true;
+            duration.clear();
+            path.clear();
+        }
+        else if(entry && isStreamElement("Duration"))
+        {
+            duration = readStreamAttribute("value").mid(3, 5);
+        }
+        else if(entry && isStreamElement("Ref"))
         {
-            item.m_songs << MusicSong(path, 0, duration, QString());
+            path = readStreamAttribute("href");
         }
     }
 
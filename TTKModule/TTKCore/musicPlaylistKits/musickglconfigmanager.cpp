@@ -14,25 +14,37 @@ bool MusicKGLConfigManager::readPlaylistData(MusicSongItems &items)
     MusicSongItem item;
     item.m_itemName = QFileInfo(m_file->fileName()).baseName();
 
-    MusicXmlNodeHelper nodeHelper(m_document->documentElement());
-    nodeHelper.load();
-
     QTextCodec *codec = QTextCodec::codecForName("windows-1252");
-    const QDomNodeList &nodes = m_document->elementsByTagName(nodeHelper.nodeName("File"));
-    for(int i=0; i<nodes.count(); ++i)
+    ///file params are collected until the next file starts
+    bool file = false;
+    MusicSong song;
+    while(true)
     {
-        MusicSong song;
-        const QDomNodeList &cNodes = nodes.at(i).childNodes();
-        for(int i=0; i<cNodes.count(); ++i)
+        const bool hasNext = readStreamElement();
+        if(!hasNext || isStreamElement("File"))
+        {
+            if(file)
+            {
+                item.m_songs << song;
+            }
+
+            if(!hasNext)
+            {
+                break;
+            }
+
+            file = true;
+            song = MusicSong();
+        }
+        else if(file)
         {
-            const QDomNode &cNode = cNodes.at(i);
-            if(cNode.nodeName().toLower() == "duration")
+            if(isStreamElement("Duration"))
             {
-                song.setMusicPlayTime(MusicTime::msecTime2LabelJustified(cNode.toElement().text().toULongLong()));
+                song.setMusicPlayTime(MusicTime::msecTime2LabelJustified(readStreamText().toULongLong()));
             }
-            else if(cNode.nodeName().toLower() == "filename")
+            else if(isStreamElement("FileName"))
             {
-                const QFileInfo info(codec->fromUnicode(cNode.toElement().text()));
+                const QFileInfo info(codec->fromUnicode(readStreamText()));
                 song.setMusicName(info.baseName());
                 song.setMusicType(info.suffix());
 
@@ -45,9 +57,9 @@ bool MusicKGLConfigManager::readPlaylistData(MusicSongItems &items)
                     song.setMusicPath(song.getMusicPath() + info.fileName());
                 }
             }
-            else if(cNode.nodeName().toLower() == "filepath")
+            else if(isStreamElement("FilePath"))
             {
-                const QString &path = codec->fromUnicode(cNode.toElement().text());
+                const QString &path = codec->fromUnicode(readStreamText());
                 if(song.getMusicName().isEmpty())
                 {
                     song.setMusicPath(path);
@@ -57,12 +69,11 @@ bool MusicKGLConfigManager::readPlaylistData(MusicSongItems &items)
                     song.setMusicPath(path + song.getMusicName() + "." + song.getMusicType());
                 }
             }
-            else if(cNode.nodeName().toLower() == "filesize")
+            else if(isStreamElement("FileSize"))
             {
-                song.setMusicSize(cNode.toElement().text().toLongLong());
+                song.setMusicSize(readStreamText().toLongLong());
             }
         }
-        item.m_songs << song;
     }
 
     if(!item.m_songs.isEmpty())
@@ -35,6 +35,11 @@ public:
      */
     explicit MusicKGLConfigManager(QObject *parent = nullptr);
 
+    /*!
+     * Read datas from xml file by given name.
+     */
+    inline bool readConfig(const QString &name) { return readStreamConfig(name); }
+
     /*!
      * Read datas from config file.
      */
@@ -9,21 +9,26 @@ MusicTKPLConfigManager::MusicTKPLConfigManager(QObject *parent)
 
 bool MusicTKPLConfigManager::readPlaylistData(MusicSongItems &items)
 {
-    const QDomNodeList &nodes = m_document->elementsByTagName("musicList");
-    for(int i=0; i<nodes.count(); ++i)
+    while(readStreamElement())
     {
-        const QDomNode &node = nodes.at(i);
-        MusicSongItem item;
-        item.m_songs = readMusicFilePath(node);
-
-        const QDomElement &element = node.toElement();
-        item.m_itemIndex = element.attribute("index").toInt();
-        item.m_itemName = element.attribute("name");
+        if(isStreamElement("musicList"))
+        {
+            MusicSongItem item;
+            item.m_itemIndex = readStreamAttribute("index").toInt();
+            item.m_itemName = readStreamAttribute("name");
 
-        const QString &string = element.attribute("sortIndex");
-        item.m_sort.m_index = string.isEmpty() ? -1 : string.toInt();
-        item.m_sort.m_sortType = TTKStatic_cast(Qt::SortOrder, element.attribute("sortType").toInt());
-        items << item;
+            const QString &string = readStreamAttribute("sortIndex");
+            item.m_sort.m_index = string.isEmpty() ? -1 : string.toInt();
+            item.m_sort.m_sortType = TTKStatic_cast(Qt::SortOrder, readStreamAttribute("sortType").toInt());
+            items << item;
+        }
+        else if(isStreamElement("value") && !items.isEmpty())
+        {
+            const QString &name = readStreamAttribute("name");
+            const QString &time = readStreamAttribute("time");
+            const int playCount = readStreamAttribute("playCount").toInt();
+            items.last().m_songs << MusicSong(readStreamText(), playCount, time, name);
+        }
     }
     return true;
 }
@@ -35,46 +40,29 @@ bool MusicTKPLConfigManager::writePlaylistData(const MusicSongItems &items)
 
 bool MusicTKPLConfigManager::writePlaylistData(const MusicSongItems &items, const QString &path)
 {
-    if(items.isEmpty() || !writeConfig(path))
+    if(items.isEmpty() || !writeStreamConfig(path))
     {
         return false;
     }
     //
-    createProcessingInstruction();
-    QDomElement musicPlayer = createRoot(APP_NAME);
+    writeStreamRoot(APP_NAME);
     for(int i=0; i<items.count(); ++i)
     {
         const MusicSongItem &item = items[i];
-        QDomElement pathDom = writeDomElementMutil(musicPlayer, "musicList", MusicXmlAttributes()
-                              << MusicXmlAttribute("name", item.m_itemName) << MusicXmlAttribute("index", i)
-                              << MusicXmlAttribute("count", item.m_songs.count()) << MusicXmlAttribute("sortIndex", item.m_sort.m_index)
-                              << MusicXmlAttribute("sortType", item.m_sort.m_sortType));
+        writeStreamElement("musicList", MusicXmlAttributes()
+                           << MusicXmlAttribute("name", item.m_itemName) << MusicXmlAttribute("index", i)
+                           << MusicXmlAttribute("count", item.m_songs.count()) << MusicXmlAttribute("sortIndex", item.m_sort.m_index)
+                           << MusicXmlAttribute("sortType", item.m_sort.m_sortType));
         for(const MusicSong &song : qAsConst(item.m_songs))
         {
-            writeDomElementMutilText(pathDom, "value", MusicXmlAttributes()
-                                     << MusicXmlAttribute("name", song.getMusicName())
-                                     << MusicXmlAttribute("playCount", song.getMusicPlayCount())
-                                     << MusicXmlAttribute("time", song.getMusicPlayTime()), song.getMusicPath());
+            writeStreamElementText("value", MusicXmlAttributes()
+                                   << MusicXmlAttribute("name", song.getMusicName())
+                                   << MusicXmlAttribute("playCount", song.getMusicPlayCount())
+                                   << MusicXmlAttribute("time", song.getMusicPlayTime()), song.getMusicPath());
         }
+        writeStreamEndElement();
     }
 
-    QTextStream out(m_file);
-    m_document->save(out, 4);
+    writeStreamEnd();
     return true;
 }
-
-MusicSongs MusicTKPLConfigManager::readMusicFilePath(const QDomNode &node) const
-{
-    const QDomNodeList &nodeList = node.childNodes();
-
-    MusicSongs songs;
-    for(int i=0; i<nodeList.count(); i++)
-    {
-        const QDomElement &element = nodeList.at(i).toElement();
-        songs << MusicSong(element.text(),
-                           element.attribute("playCount").toInt(),
-                           element.attribute("time"),
-                           element.attribute("name"));
-    }
-    return songs;
-}
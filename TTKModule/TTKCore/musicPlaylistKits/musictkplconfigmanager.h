@@ -38,7 +38,7 @@ public:
     /*!
      * Read config datas from xml file by given name.
      */
-    inline bool readConfig(const QString &name = MUSICPATH_FULL) { return MusicAbstractXml::readConfig(name); }
+    inline bool readConfig(const QString &name = MUSICPATH_FULL) { return readStreamConfig(name); }
 
     /*!
      * Read datas from config file.
@@ -53,12 +53,6 @@ public:
      */
     virtual bool writePlaylistData(const MusicSongItems &items, const QString &path) override;
 
-protected:
-    /*!
-     * Read Music File Path.
-     */
-    MusicSongs readMusicFilePath(const QDomNode &node) const;
-
 };
 
 #endif // MUSICTKPLCONFIGMANAGER_H
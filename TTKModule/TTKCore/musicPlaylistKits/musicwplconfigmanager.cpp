@@ -10,17 +10,19 @@ MusicWPLConfigManager::MusicWPLConfigManager(QObject *parent)
 
 bool MusicWPLConfigManager::readPlaylistData(MusicSongItems &items)
 {
-    MusicXmlNodeHelper nodeHelper(m_document->documentElement());
-    nodeHelper.load();
-
-    const QDomNodeList &sepNodes = m_document->elementsByTagName(nodeHelper.nodeName("seq"));
-    for(int i=0; i<sepNodes.count(); ++i)
+    const QString &name = QFileInfo(m_file->fileName()).baseName();
+    while(readStreamElement())
     {
-        const QDomNode &node = sepNodes.at(i);
-        MusicSongItem item;
-        item.m_itemName = QFileInfo(m_file->fileName()).baseName();
-        item.m_songs = readMusicFilePath(node);
-        items << item;
+        if(isStreamElement("seq"))
+        {
+            MusicSongItem item;
+            item.m_itemName = name;
+            items << item;
+        }
+        else if(isStreamElement("media") && !items.isEmpty())
+        {
+            items.last().m_songs << MusicSong(readStreamAttribute("src"), 0, QString(), QString());
+        }
     }
     return true;
 }
@@ -56,16 +58,3 @@ bool MusicWPLConfigManager::writePlaylistData(const MusicSongItems &items, const
     m_document->save(out, 4);
     return true;
 }
-
-MusicSongs MusicWPLConfigManager::readMusicFilePath(const QDomNode &node) const
-{
-    const QDomNodeList &nodeList = node.childNodes();
-
-    MusicSongs songs;
-    for(int i=0; i<nodeList.count(); i++)
-    {
-        const QDomElement &element = nodeList.at(i).toElement();
-        songs << MusicSong(element.attribute("src"), 0, QString(), QString());
-    }
-    return songs;
-}
@@ -35,6 +35,11 @@ public:
      */
     explicit MusicWPLConfigManager(QObject *parent = nullptr);
 
+    /*!
+     * Read datas from xml file by given name.
+     */
+    inline bool readConfig(const QString &name) { return readStreamConfig(name); }
+
     /*!
      * Read datas from config file.
      */
@@ -44,12 +49,6 @@ public:
      */
     virtual bool writePlaylistData(const MusicSongItems &items, const QString &path) override;
 
-protected:
-    /*!
-     * Read Music File Path.
-     */
-    MusicSongs readMusicFilePath(const QDomNode &node) const;
-
 };
 
 #endif // MUSICWPLCONFIGMANAGER_H
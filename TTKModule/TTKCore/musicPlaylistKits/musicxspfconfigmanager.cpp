@@ -9,24 +9,26 @@ MusicXSPFConfigManager::MusicXSPFConfigManager(QObject *parent)
 
 bool MusicXSPFConfigManager::readPlaylistData(MusicSongItems &items)
 {
-    MusicXmlNodeHelper nodeHelper(m_document->documentElement());
-    nodeHelper.load();
-
-    const QDomNodeList &trackNodes = m_document->elementsByTagName(nodeHelper.nodeName("trackList"));
-    for(int i=0; i<trackNodes.count(); ++i)
+    while(readStreamElement())
     {
-        const QDomNode &node = trackNodes.at(i);
-        MusicSongItem item;
-        item.m_songs = readMusicFilePath(node);
-
-        const QDomElement &element = node.toElement();
-        item.m_itemIndex = element.attribute("index").toInt();
-        item.m_itemName = element.attribute("name");
+        if(isStreamElement("trackList"))
+        {
+            MusicSongItem item;
+            item.m_itemIndex = readStreamAttribute("index").toInt();
+            item.m_itemName = readStreamAttribute("name");
 
-        const QString &string = element.attribute("sortIndex");
-        item.m_sort.m_index = string.isEmpty() ? -1 : string.toInt();
-        item.m_sort.m_sortType = TTKStatic_cast(Qt::SortOrder, element.attribute("sortType").toInt());
-        items << item;
+            const QString &string = readStreamAttribute("sortIndex");
+            item.m_sort.m_index = string.isEmpty() ? -1 : string.toInt();
+            item.m_sort.m_sortType = TTKStatic_cast(Qt::SortOrder, readStreamAttribute("sortType").toInt());
+            items << item;
+        }
+        else if(isStreamElement("track") && !items.isEmpty())
+        {
+            items.last().m_songs << MusicSong(readStreamAttribute("src"),
+                                              readStreamAttribute("playCount").toInt(),
+                                              readStreamAttribute("time"),
+                                              readStreamAttribute("name"));
+        }
     }
     return true;
 }
@@ -72,19 +74,3 @@ bool MusicXSPFConfigManager::writePlaylistData(const MusicSongItems &items, cons
     m_document->save(out, 4);
     return true;
 }
-
-MusicSongs MusicXSPFConfigManager::readMusicFilePath(const QDomNode &node) const
-{
-    const QDomNodeList &nodeList = node.childNodes();
-
-    MusicSongs songs;
-    for(int i=0; i<nodeList.count(); i++)
-    {
-        const QDomElement &element = nodeList.at(i).toElement();
-        songs << MusicSong(element.attribute("src"),
-                           element.attribute("playCount").toInt(),
-                           element.attribute("time"),
-                           element.attribute("name"));
-    }
-    return songs;
-}
@@ -8,33 +8,35 @@ MusicLocalSongSearchRecordConfigManager::MusicLocalSongSearchRecordConfigManager
 
 void MusicLocalSongSearchRecordConfigManager::readSearchData(MusicSearchRecords &records)
 {
-    const QDomNodeList &nodeList = m_document->elementsByTagName("value");
-    for(int i=0; i<nodeList.count(); ++i)
+    while(readStreamElement())
     {
+        if(!isStreamElement("value"))
+        {
+            continue;
+        }
+
         MusicSearchRecord record;
-        record.m_name = nodeList.at(i).toElement().attribute("name");
-        record.m_time = nodeList.at(i).toElement().text();
+        record.m_name = readStreamAttribute("name");
+        record.m_time = readStreamText();
         records << record;
     }
 }
 
 void MusicLocalSongSearchRecordConfigManager::writeSearchData(const MusicSearchRecords &records)
 {
-    if(!writeConfig(MUSICSEARCH_FULL))
+    if(!writeStreamConfig(MUSICSEARCH_FULL))
     {
         return;
     }
 
     //
-    createProcessingInstruction();
-    QDomElement musicPlayer = createRoot(APP_NAME);
-    QDomElement download = writeDomNode(musicPlayer, "searchRecord");
+    writeStreamRoot(APP_NAME);
+    writeStreamElement("searchRecord");
 
     for(const MusicSearchRecord &record : qAsConst(records))
     {
-        writeDomElementText(download, "value", MusicXmlAttribute("name", record.m_name), record.m_time);
+        writeStreamElementText("value", MusicXmlAttributes() << MusicXmlAttribute("name", record.m_name), record.m_time);
     }
 
-    QTextStream out(m_file);
-    m_document->save(out, 4);
+    writeStreamEnd();
 }
@@ -8,38 +8,40 @@ MusicDownloadRecordConfigManager::MusicDownloadRecordConfigManager(MusicObject::
 
 void MusicDownloadRecordConfigManager::readDownloadData(MusicSongs &records)
 {
-    const QDomNodeList &nodeList = m_document->elementsByTagName("value");
-    for(int i=0; i<nodeList.count(); ++i)
+    while(readStreamElement())
     {
+        if(!isStreamElement("value"))
+        {
+            continue;
+        }
+
         MusicSong record;
-        record.setMusicName(nodeList.at(i).toElement().attribute("name"));
-        record.setMusicSizeStr(nodeList.at(i).toElement().attribute("size"));
-        record.setMusicAddTimeStr(nodeList.at(i).toElement().attribute("time"));
-        record.setMusicPath(nodeList.at(i).toElement().text());
+        record.setMusicName(readStreamAttribute("name"));
+        record.setMusicSizeStr(readStreamAttribute("size"));
+        record.setMusicAddTimeStr(readStreamAttribute("time"));
+        record.setMusicPath(readStreamText());
         records << record;
     }
 }
 
 void MusicDownloadRecordConfigManager::writeDownloadData(const MusicSongs &records)
 {
-    if(!writeConfig(mappingFilePathFromEnum()))
+    if(!writeStreamConfig(mappingFilePathFromEnum()))
     {
         return;
     }
     //
-    createProcessingInstruction();
-    QDomElement musicPlayer = createRoot(APP_NAME);
-    QDomElement download = writeDomNode(musicPlayer, "download");
+    writeStreamRoot(APP_NAME);
+    writeStreamElement("download");
 
     for(const MusicSong &record : qAsConst(records))
     {
-        writeDomElementMutilText(download, "value", MusicXmlAttributes() << MusicXmlAttribute("name", record.getMusicName())
-                                                 << MusicXmlAttribute("size", record.getMusicSizeStr())
-                                                 << MusicXmlAttribute("time", record.getMusicAddTimeStr()), record.getMusicPath());
+        writeStreamElementText("value", MusicXmlAttributes() << MusicXmlAttribute("name", record.getMusicName())
+                                        << MusicXmlAttribute("size", record.getMusicSizeStr())
+                                        << MusicXmlAttribute("time", record.getMusicAddTimeStr()), record.getMusicPath());
     }
 
-    QTextStream out(m_file);
-    m_document->save(out, 4);
+    writeStreamEnd();
 }
 
 QString MusicDownloadRecordConfigManager::mappingFilePathFromEnum() const
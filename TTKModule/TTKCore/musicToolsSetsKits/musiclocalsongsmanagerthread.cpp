@@ -1,11 +1,45 @@
 #include "musiclocalsongsmanagerthread.h"
 #include "musicformats.h"
-#include "musicfileutils.h"
+#include "musicobject.h"
+
+#include <QTimer>
+#include <QDateTime>
+#include <QDataStream>
+#include <QFileSystemWatcher>
+#if TTK_QT_VERSION_CHECK(5,0,0)
+#  include <QtConcurrent/QtConcurrent>
+#else
+#  include <QtConcurrentRun>
+#endif
+
+#define SCAN_BATCH_SIZE         256
+#define SCAN_JOURNAL_VERSION    1
+#define WATCH_DIR_MAX_COUNT     4096
+#define WATCH_DELAY_INTERVAL    2000
 
 MusicLocalSongsManagerThread::MusicLocalSongsManagerThread(QObject *parent)
     : MusicAbstractThread(parent)
 {
+    m_journalLoaded = false;
+#ifdef Q_OS_LINUX
+    m_watchEnabled = true;
+#else
+    m_watchEnabled = false;
+#endif
+
+    m_watcher = new QFileSystemWatcher(this);
+    m_watchTimer = new QTimer(this);
+    m_watchTimer->setSingleShot(true);
+    m_watchTimer->setInterval(WATCH_DELAY_INTERVAL);
 
+    connect(m_watcher, SIGNAL(directoryChanged(QString)), m_watchTimer, SLOT(start()));
+    connect(m_watchTimer, SIGNAL(timeout()), SLOT(directoryChanged()));
+    connect(this, SIGNAL(finished()), SLOT(updateWatchPaths()));
+}
+
+MusicLocalSongsManagerThread::~MusicLocalSongsManagerThread()
+{
+    stopAndQuitThread();
 }
 
 void MusicLocalSongsManagerThread::setFindFilePath(const QString &path)
@@ -18,18 +52,207 @@ void MusicLocalSongsManagerThread::setFindFilePath(const QStringList &path)
     m_path = path;
 }
 
+void MusicLocalSongsManagerThread::setWatchEnabled(bool enabled)
+{
+    m_watchEnabled = enabled;
+    if(!m_watchEnabled && !m_watcher->directories().isEmpty())
+    {
+        m_watcher->removePaths(m_watcher->directories());
+    }
+}
+
+void MusicLocalSongsManagerThread::updateWatchPaths()
+{
+    if(!m_watcher->directories().isEmpty())
+    {
+        m_watcher->removePaths(m_watcher->directories());
+    }
+
+    if(m_watchEnabled && m_running && !m_visited.isEmpty())
+    {
+        m_watcher->addPaths(m_visited.mid(0, WATCH_DIR_MAX_COUNT));
+    }
+}
+
+void MusicLocalSongsManagerThread::directoryChanged()
+{
+    if(!isRunning())
+    {
+        start();
+    }
+}
+
 void MusicLocalSongsManagerThread::run()
 {
     MusicAbstractThread::run();
 
-    QFileInfoList list;
-    for(const QString &path : qAsConst(m_path))
+    readJournal();
+    m_visited.clear();
+
+    const QStringList &filter = MusicFormats::supportFormatsFilter();
+    QList< QFuture<QFileInfoList> > futures;
+    for(int i=1; i<m_path.count(); ++i)
     {
-        if(m_running)
+        const QString &root = m_path[i];
+        futures << QtConcurrent::run([=]
         {
-            list << MusicUtils::File::getFileListByDir(path, MusicFormats::supportFormatsFilter(), true);
-        }
+            return findFilePath(root, filter);
+        });
+    }
+
+    QFileInfoList list;
+    if(!m_path.isEmpty())
+    {
+        list << findFilePath(m_path.first(), filter);
+    }
+
+    for(QFuture<QFileInfoList> &future : futures)
+    {
+        future.waitForFinished();
+        list << future.result();
+    }
+
+    if(m_running)
+    {
+        writeJournal();
     }
     ///The name and path search ended when sending the corresponding
     Q_EMIT setSongNamePath(list);
 }
+
+QFileInfoList MusicLocalSongsManagerThread::findFilePath(const QString &root, const QStringList &filter)
+{
+    QFileInfoList list, batch;
+    const QString &base = QDir(root).absolutePath();
+    QStringList dirs(base), visited;
+
+    while(m_running && !dirs.isEmpty())
+    {
+        const QString &dir = dirs.takeLast();
+        const QFileInfo info(dir);
+        if(!info.isDir())
+        {
+            continue;
+        }
+
+        const qint64 modified = info.lastModified().toMSecsSinceEpoch();
+        m_mutex.lock();
+        MusicLocalSongsScanItem item = m_journal.value(dir);
+        m_mutex.unlock();
+
+        if(item.m_modified != modified)
+        {
+            const QDir d(dir);
+            item.m_modified = modified;
+            item.m_files = d.entryList(filter, QDir::Files | QDir::Hidden | QDir::NoSymLinks);
+            item.m_dirs = d.entryList(QDir::Dirs | QDir::NoSymLinks | QDir::NoDotAndDotDot);
+
+            m_mutex.lock();
+            m_journal.insert(dir, item);
+            m_mutex.unlock();
+        }
+
+        visited << dir;
+        const QString &prefix = dir.endsWith("/") ? dir : dir + "/";
+        for(const QString &file : qAsConst(item.m_files))
+        {
+            batch << QFileInfo(prefix + file);
+        }
+
+        for(const QString &sub : qAsConst(item.m_dirs))
+        {
+            dirs << prefix + sub;
+        }
+
+        if(batch.count() >= SCAN_BATCH_SIZE)
+        {
+            Q_EMIT searchFilePathChanged(batch);
+            list << batch;
+            batch.clear();
+        }
+    }
+
+    if(!batch.isEmpty())
+    {
+        Q_EMIT searchFilePathChanged(batch);
+        list << batch;
+    }
+
+    m_mutex.lock();
+    m_visited << visited;
+    if(m_running)
+    {
+        ///remove journal item which is not exist any more under current root
+        QSet<QString> exist;
+        for(const QString &dir : qAsConst(visited))
+        {
+            exist.insert(dir);
+        }
+
+        const QString &prefix = base.endsWith("/") ? base : base + "/";
+        for(auto it = m_journal.begin(); it != m_journal.end(); )
+        {
+            if((it.key() == base || it.key().startsWith(prefix)) && !exist.contains(it.key()))
+            {
+                it = m_journal.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    m_mutex.unlock();
+
+    return list;
+}
+
+void MusicLocalSongsManagerThread::readJournal()
+{
+    if(m_journalLoaded)
+    {
+        return;
+    }
+
+    m_journalLoaded = true;
+    QFile file(SCANPATH_FULL);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    QDataStream stream(&file);
+    int version = 0, count = 0;
+    stream >> version >> count;
+    if(version != SCAN_JOURNAL_VERSION)
+    {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    for(int i=0; i<count && !stream.atEnd(); ++i)
+    {
+        QString path;
+        MusicLocalSongsScanItem item;
+        stream >> path >> item.m_modified >> item.m_files >> item.m_dirs;
+        m_journal.insert(path, item);
+    }
+}
+
+void MusicLocalSongsManagerThread::writeJournal()
+{
+    QFile file(SCANPATH_FULL);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    QDataStream stream(&file);
+    stream << int(SCAN_JOURNAL_VERSION) << m_journal.count();
+    for(auto it = m_journal.constBegin(); it != m_journal.constEnd(); ++it)
+    {
+        const MusicLocalSongsScanItem &item = it.value();
+        stream << it.key() << item.m_modified << item.m_files << item.m_dirs;
+    }
+}
@@ -19,10 +19,33 @@
  * with this program; If not, see <http://www.gnu.org/licenses/>.
  ================================================= */
 
+#include <QMutex>
 #include <QFileInfoList>
 #include "musicabstractthread.h"
 
+class QTimer;
+class QFileSystemWatcher;
+
+/*! @brief The class of the local songs scan journal item.
+ * @author Greedysky <greedysky@163.com>
+ */
+typedef struct TTK_MODULE_EXPORT MusicLocalSongsScanItem
+{
+    qint64 m_modified;
+    QStringList m_files;
+    QStringList m_dirs;
+
+    MusicLocalSongsScanItem()
+    {
+        m_modified = -1;
+    }
+}MusicLocalSongsScanItem;
+typedef QHash<QString, MusicLocalSongsScanItem> MusicLocalSongsScanJournal;
+
+
 /*! @brief The class of the local songs manager thread.
+ * Walks all roots in parallel and emits found files in batches, directories
+ * whose modified time is unchanged since last scan are read from journal.
  * @author Greedysky <greedysky@163.com>
  */
 class TTK_MODULE_EXPORT MusicLocalSongsManagerThread : public MusicAbstractThread
@@ -34,6 +57,7 @@ public:
      * Object contsructor.
      */
     explicit MusicLocalSongsManagerThread(QObject *parent = nullptr);
+    ~MusicLocalSongsManagerThread();
 
     /*!
      * Set find file path by given path.
@@ -43,21 +67,56 @@ public:
      * Set find file path by given path lists.
      */
     void setFindFilePath(const QStringList &path);
+    /*!
+     * Set watch searched dirs for live updates.
+     */
+    void setWatchEnabled(bool enabled);
 
 Q_SIGNALS:
     /*!
      * Send the searched file or path.
      */
     void setSongNamePath(const QFileInfoList &name);
+    /*!
+     * Send the searched file or path batch while searching.
+     */
+    void searchFilePathChanged(const QFileInfoList &name);
+
+private Q_SLOTS:
+    /*!
+     * Update watched dirs after search finished.
+     */
+    void updateWatchPaths();
+    /*!
+     * Watched dir changed.
+     */
+    void directoryChanged();
 
 protected:
     /*!
      * Thread run now.
      */
     virtual void run() override;
+    /*!
+     * Walk dirs of given root.
+     */
+    QFileInfoList findFilePath(const QString &root, const QStringList &filter);
+    /*!
+     * Read scan journal from file.
+     */
+    void readJournal();
+    /*!
+     * Write scan journal into file.
+     */
+    void writeJournal();
 
 protected:
-    QStringList m_path;
+    QStringList m_path, m_visited;
+    QMutex m_mutex;
+    bool m_journalLoaded, m_watchEnabled;
+    MusicLocalSongsScanJournal m_journal;
+    QFileSystemWatcher *m_watcher;
+    QTimer *m_watchTimer;
 
 };
 
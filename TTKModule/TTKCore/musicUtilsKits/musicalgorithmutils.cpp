@@ -1,8 +1,47 @@
 #include "musicalgorithmutils.h"
 #include "musiccryptographichash.h"
 
+#include <QReadWriteLock>
 #include <QCryptographicHash>
 
+/*! @brief The class of the decoded mdII endpoint table.
+ * Endpoints are constant strings, decode them once and share the result.
+ * @author Greedysky <greedysky@163.com>
+ */
+class MusicDecodedStringTable
+{
+public:
+    QString value(const QString &data)
+    {
+        QReadLocker locker(&m_lock);
+        return m_items.value(data);
+    }
+
+    void insert(const QString &data, const QString &value)
+    {
+        QWriteLocker locker(&m_lock);
+        m_items.insert(data, value);
+    }
+
+private:
+    QReadWriteLock m_lock;
+    QHash<QString, QString> m_items;
+
+};
+
+static QString decodeEndpoint(const QString &data)
+{
+    static MusicDecodedStringTable table;
+    QString value = table.value(data);
+    if(value.isEmpty() && !data.isEmpty())
+    {
+        MusicCryptographicHash hash;
+        value = hash.decrypt(data, ALG_URL_KEY);
+        table.insert(data, value);
+    }
+    return value;
+}
+
 QByteArray MusicUtils::Algorithm::md5(const QByteArray &data)
 {
     return QCryptographicHash::hash(data, QCryptographicHash::Md5);
@@ -40,8 +79,12 @@ QByteArray MusicUtils::Algorithm::hmacSha1(const QByteArray &data, const QByteAr
 
 QString MusicUtils::Algorithm::mdII(const QString &data, bool encode)
 {
-    MusicCryptographicHash hash;
-    return encode ? hash.encrypt(data, ALG_URL_KEY) : hash.decrypt(data, ALG_URL_KEY);
+    ///only constant endpoints are decoded by the url key, so the table stays small
+    if(!encode)
+    {
+        return decodeEndpoint(data);
+    }
+    return mdII(data, ALG_URL_KEY, encode);
 }
 
 QString MusicUtils::Algorithm::mdII(const QString &data, const QString &key, bool encode)
@@ -26,27 +26,6 @@ quint64 MusicUtils::File::dirSize(const QString &dirName)
     return size;
 }
 
-void MusicUtils::File::checkCacheSize(quint64 cacheSize, bool disabled, const QString &path)
-{
-    if(disabled)
-    {
-        quint64 size = dirSize(path);
-        if(size > cacheSize)
-        {
-            const QFileInfoList &fileList = QDir(path).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot);
-            for(const QFileInfo &fileInfo : qAsConst(fileList))
-            {
-                size -= fileInfo.size();
-                QFile::remove(fileInfo.absoluteFilePath());
-                if(size <= cacheSize)
-                {
-                    break;
-                }
-            }
-        }
-    }
-}
-
 QFileInfoList MusicUtils::File::getFileListByDir(const QString &dpath, bool recursively)
 {
     return getFileListByDir(dpath, QStringList(), recursively);
@@ -33,10 +33,6 @@ namespace MusicUtils
          * Get given dir size.
          */
         TTK_MODULE_EXPORT quint64 dirSize(const QString &dirName);
-        /*!
-         * Check given dir size is bigger than given size.
-         */
-        TTK_MODULE_EXPORT void checkCacheSize(quint64 cacheSize, bool disabled, const QString &path);
         /*!
          * Get all files in given dir.
          */
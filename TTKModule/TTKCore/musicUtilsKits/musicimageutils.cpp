@@ -98,28 +98,49 @@ void MusicUtils::Image::fusionPixmap(QImage &back, const QImage &front, const QP
 
 QPixmap MusicUtils::Image::grayScalePixmap(const QPixmap &input, int radius)
 {
-    QImage pix = input.toImage();
-    for(int w=0; w<pix.width(); w++)
+    QImage pix = input.toImage().convertToFormat(QImage::Format_ARGB32);
+    uchar table[256];
+    for(int i=0; i<256; ++i)
     {
-        for(int h=0; h<pix.height(); h++)
+        table[i] = qBound(0, i + radius, 255);
+    }
+
+    const int width = pix.width();
+    uchar *bits = pix.bits();
+    const int bytes = pix.bytesPerLine();
+    QImageWrapper::renderRows(width, pix.height(), [=](int begin, int end)
+    {
+        for(int h=begin; h<end; ++h)
         {
-            int gray = qGray(pix.pixel(w, h)) + radius;
-                gray = qBound(0, gray, 255);
-            const QRgb rgb = qRgb(gray, gray, gray);
-            pix.setPixel(w, h, rgb);
+            QRgb *line = TTKReinterpret_cast(QRgb*, bits + h * bytes);
+            for(int w=0; w<width; ++w)
+            {
+                const int gray = table[qGray(line[w])];
+                line[w] = qRgb(gray, gray, gray);
+            }
         }
-    }
+    });
     return QPixmap::fromImage(pix);
 }
 
 int MusicUtils::Image::grayScaleAverage(const QImage &input, int width, int height)
 {
-    int average = 0;
-    for(int w=0; w<width; w++)
+    if(width <= 0 || height <= 0)
+    {
+        return 0;
+    }
+
+    const QImage &image = (input.format() == QImage::Format_ARGB32 || input.format() == QImage::Format_RGB32) ? input : input.convertToFormat(QImage::Format_ARGB32);
+    width = qMin(width, image.width());
+    height = qMin(height, image.height());
+
+    qint64 average = 0;
+    for(int h=0; h<height; ++h)
     {
-        for(int h=0; h<height; h++)
+        const QRgb *line = TTKReinterpret_cast(const QRgb*, image.constScanLine(h));
+        for(int w=0; w<width; ++w)
         {
-            average += qBound(0, qGray(input.pixel(w, h)), 255);
+            average += qGray(line[w]);
         }
     }
     return average / (width * height);
@@ -145,16 +166,43 @@ int MusicUtils::Image::reRenderAlpha(int alpha, int value)
 
 void MusicUtils::Image::reRenderImage(int delta, const QImage *input, QImage *output)
 {
-    for(int w=0; w<input->width(); w++)
+    const bool direct = (input->format() == QImage::Format_ARGB32 || input->format() == QImage::Format_RGB32);
+    const bool inplace = direct && input == output;
+
+    QImage source;
+    if(!inplace)
     {
-        for(int h=0; h<input->height(); h++)
+        source = direct ? *input : input->convertToFormat(QImage::Format_ARGB32);
+        if(output->size() != source.size() || output->format() != source.format())
         {
-            const QRgb rgb = input->pixel(w, h);
-            output->setPixel(w, h, qRgb(colorBurnTransform(qRed(rgb), delta),
-                                        colorBurnTransform(qGreen(rgb), delta),
-                                        colorBurnTransform(qBlue(rgb), delta)));
+            *output = QImage(source.size(), source.format());
         }
     }
+
+    ///color burn is per channel, so build the table once instead of per pixel division
+    uchar table[256];
+    for(int i=0; i<256; ++i)
+    {
+        table[i] = colorBurnTransform(i, delta);
+    }
+
+    const int width = output->width();
+    uchar *bits = output->bits();
+    const uchar *from = inplace ? bits : source.constBits();
+    const int bytes = output->bytesPerLine(), fromBytes = inplace ? bytes : source.bytesPerLine();
+    QImageWrapper::renderRows(width, output->height(), [=](int begin, int end)
+    {
+        for(int h=begin; h<end; ++h)
+        {
+            const QRgb *in = TTKReinterpret_cast(const QRgb*, from + h * fromBytes);
+            QRgb *out = TTKReinterpret_cast(QRgb*, bits + h * bytes);
+            for(int w=0; w<width; ++w)
+            {
+                const QRgb rgb = in[w];
+                out[w] = qRgb(table[qRed(rgb)], table[qGreen(rgb)], table[qBlue(rgb)]);
+            }
+        }
+    });
 }
 
 int MusicUtils::Image::colorBurnTransform(int c, int delta)
@@ -8,35 +8,36 @@ MusicBarrageRecordConfigManager::MusicBarrageRecordConfigManager(QObject *parent
 
 void MusicBarrageRecordConfigManager::readBarrageData(MusicBarrageRecords &records)
 {
-    const QDomNodeList &nodeList = m_document->elementsByTagName("value");
-    for(int i=0; i<nodeList.count(); ++i)
+    while(readStreamElement())
     {
+        if(!isStreamElement("value"))
+        {
+            continue;
+        }
+
         MusicBarrageRecord record;
-        record.m_color = nodeList.at(i).toElement().attribute("color");
-        record.m_size = nodeList.at(i).toElement().attribute("size").toInt();
-        record.m_value = nodeList.at(i).toElement().text();
+        record.m_color = readStreamAttribute("color");
+        record.m_size = readStreamAttribute("size").toInt();
+        record.m_value = readStreamText();
         records << record;
     }
 }
 
 void MusicBarrageRecordConfigManager::writeBarrageData(const MusicBarrageRecords &records)
 {
-    if(!writeConfig(BARRAGEPATH_FULL))
+    if(!writeStreamConfig(BARRAGEPATH_FULL))
     {
         return;
     }
     //
-    createProcessingInstruction();
-    //
-    QDomElement musicPlayer = createRoot(APP_NAME);
-    QDomElement download = writeDomNode(musicPlayer, "barrageRecord");
+    writeStreamRoot(APP_NAME);
+    writeStreamElement("barrageRecord");
 
     for(const MusicBarrageRecord &record : qAsConst(records))
     {
-        writeDomElementMutilText(download, "value", MusicXmlAttributes() << MusicXmlAttribute("color", record.m_color)
-                                 << MusicXmlAttribute("size", record.m_size), record.m_value);
+        writeStreamElementText("value", MusicXmlAttributes() << MusicXmlAttribute("color", record.m_color)
+                                        << MusicXmlAttribute("size", record.m_size), record.m_value);
     }
 
-    QTextStream out(m_file);
-    m_document->save(out, 4);
+    writeStreamEnd();
 }
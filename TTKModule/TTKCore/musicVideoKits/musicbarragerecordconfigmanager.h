@@ -48,7 +48,7 @@ public:
     /*!
      * Read barrage datas from xml file by given name.
      */
-    inline bool readConfig() { return MusicAbstractXml::readConfig(BARRAGEPATH_FULL); }
+    inline bool readConfig() { return readStreamConfig(BARRAGEPATH_FULL); }
 
     /*!
      * Read datas from config file.
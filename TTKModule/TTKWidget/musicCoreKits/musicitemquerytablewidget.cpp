@@ -1,5 +1,6 @@
 #include "musicitemquerytablewidget.h"
 #include "musicdownloaddatarequest.h"
+#include "musicsongprefetcher.h"
 #include "musicdownloadwidget.h"
 #include "musicitemdelegate.h"
 #include "musictoastlabel.h"
@@ -347,6 +348,7 @@ bool MusicItemQueryTableWidget::downloadDataFrom(const MusicObject::MusicSongInf
         const MusicObject::MusicSongAttribute &attr = attrs.first();
         const QString &musicEnSong = MusicUtils::Algorithm::mdII(downloadInfo.m_singerName + " - " + downloadInfo.m_songName, ALG_ARC_KEY, true);
         const QString &downloadName = QString("%1%2.%3").arg(CACHE_DIR_FULL).arg(musicEnSong).arg(attr.m_format);
+        MusicSongPrefetcher::addSource(downloadName, attr.m_url);
 
         MusicSemaphoreLoop loop(this);
         MusicDownloadDataRequest *download = new MusicDownloadDataRequest(attr.m_url, downloadName, MusicObject::DownloadMusic, this);
@@ -54,6 +54,14 @@ qint64 MusicLrcContainer::getTotalTime() const
     return m_totalTime;
 }
 
+void MusicLrcContainer::syncLrcMask(qint64 position)
+{
+    for(MusicLrcManager *manager : qAsConst(m_musicLrcContainer))
+    {
+        manager->syncLrcMask(position);
+    }
+}
+
 void MusicLrcContainer::currentLrcCustom()
 {
     Q_EMIT changeCurrentLrcColorCustom();
@@ -146,3 +154,12 @@ void MusicLrcContainer::applySettingParameter(const QString &t)
         setLinearGradientColor(cl);
     }
 }
+
+MusicLrcWordTimes MusicLrcContainer::getCurrentWordTimes() const
+{
+    if(!m_lrcAnalysis)
+    {
+        return MusicLrcWordTimes();
+    }
+    return m_lrcAnalysis->getWordTimes(m_lrcAnalysis->findIndex(m_currentTime));
+}
@@ -82,6 +82,10 @@ public:
      * Get current play total time.
      */
     qint64 getTotalTime() const;
+    /*!
+     * Sync lrc mask to play position of current line.
+     */
+    void syncLrcMask(qint64 position);
 
     /*!
      * Set lrc analysis model.
@@ -153,6 +157,10 @@ protected:
      * Set setting parameter by diff type.
      */
     void applySettingParameter(const QString &t);
+    /*!
+     * Get word times of current line, empty if no word timing.
+     */
+    MusicLrcWordTimes getCurrentWordTimes() const;
 
     bool m_linkLocalLrc;
     qint64 m_currentTime, m_totalTime;
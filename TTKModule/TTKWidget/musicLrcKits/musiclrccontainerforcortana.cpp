@@ -101,7 +101,7 @@ void MusicLrcContainerForCortana::updateCurrentLrc(const QString &first, const Q
     m_musicLrcContainer[m_reverse]->reset();
     m_musicLrcContainer[m_reverse]->setText(second);
     m_musicLrcContainer[!m_reverse]->setText(first);
-    m_musicLrcContainer[!m_reverse]->startLrcMask(time);
+    m_musicLrcContainer[!m_reverse]->startLrcMask(time, getCurrentWordTimes());
 
     int width = m_musicLrcContainer[0]->x();
     m_musicLrcContainer[0]->setGeometry(0, 2, width, m_geometry.y());
@@ -86,12 +86,12 @@ void MusicLrcContainerForDesktop::updateCurrentLrc(const QString &first, const Q
         m_musicLrcContainer[m_reverse]->reset();
         m_musicLrcContainer[m_reverse]->setText(second);
         m_musicLrcContainer[!m_reverse]->setText(first);
-        m_musicLrcContainer[!m_reverse]->startLrcMask(time);
+        m_musicLrcContainer[!m_reverse]->startLrcMask(time, getCurrentWordTimes());
     }
     else
     {
         m_musicLrcContainer[0]->setText(first);
-        m_musicLrcContainer[0]->startLrcMask(time);
+        m_musicLrcContainer[0]->startLrcMask(time, getCurrentWordTimes());
     }
 
     resizeLrcSizeArea();
@@ -167,7 +167,7 @@ void MusicLrcDownloadBatchWidget::downloadButtonClicked()
         if(!d->isEmpty())
         {
             const MusicObject::MusicSongInformation info(d->getMusicSongInfos().first());
-            MusicAbstractDownLoadRequest *d = G_DOWNLOAD_QUERY_PTR->getDownloadLrcRequest(info.m_lrcUrl, path, MusicObject::DownloadLrc, this);
+            MusicAbstractDownLoadRequest *d = G_DOWNLOAD_QUERY_PTR->getDownloadLrcRequest(info.m_lrcUrl, path, MusicObject::DownloadLrc, this, info.m_queryServer);
             d->startToDownload();
             loop.exec();
 #if TTK_QT_VERSION_CHECK(5,13,0)
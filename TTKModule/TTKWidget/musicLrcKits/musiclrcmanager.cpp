@@ -136,7 +136,9 @@ MusicLrcManager::MusicLrcManager(QWidget *parent)
     m_font.setBold(true);
 
     m_lrcMaskWidth = 0;
-    m_lrcMaskWidthInterval = 0;
+    m_lrcMaskOrigin = 0;
+    m_lrcMaskDuration = 0;
+    m_lrcMaskPosition = 0;
     m_speedLevel = 1;
     m_transparent = 100;
 
@@ -151,6 +153,10 @@ MusicLrcManager::~MusicLrcManager()
 
 void MusicLrcManager::startTimerClock()
 {
+    if(!m_lrcMaskClock.isValid())
+    {
+        m_lrcMaskClock.start();
+    }
     m_timer->start(LRC_PER_TIME);
 }
 
@@ -213,6 +219,10 @@ void MusicLrcManager::reset()
 {
     m_intervalCount = 0.0f;
     m_lrcMaskWidth = 0.0f;
+    m_lrcMaskDuration = 0;
+    m_lrcMaskPosition = 0;
+    m_lrcMaskWords.clear();
+    m_lrcMaskClock.invalidate();
     m_timer->stop();
     update();
 }
@@ -227,23 +237,39 @@ void MusicLrcManager::setLrcFontSize(int size)
     update();
 }
 
-void MusicLrcManager::startLrcMask(qint64 intervaltime)
+void MusicLrcManager::startLrcMask(qint64 intervaltime, const MusicLrcWordTimes &words)
 {
     m_intervalCount = 0.0f;
     m_geometry.setX(MusicUtils::Widget::fontTextWidth(m_font, text()));
 
-    const float count = intervaltime / m_speedLevel;
-    m_lrcMaskWidthInterval = (count != 0) ? m_geometry.x() / count : 0;
+    //Line mask keeps the speed level pace, word mask follows the word times
+    m_lrcMaskDuration = intervaltime / m_speedLevel * LRC_PER_TIME;
+    m_lrcMaskWords = words;
+    m_lrcMaskPosition = 0;
     m_lrcMaskWidth = 0;
+    m_lrcMaskClock.start();
     m_timer->start(LRC_PER_TIME);
 }
 
 void MusicLrcManager::stopLrcMask()
 {
+    m_lrcMaskPosition = lrcMaskElapsed();
+    m_lrcMaskClock.invalidate();
     m_timer->stop();
     update();
 }
 
+void MusicLrcManager::syncLrcMask(qint64 position)
+{
+    if(!m_timer->isActive() || position < 0)
+    {
+        return;
+    }
+
+    m_lrcMaskPosition = position;
+    m_lrcMaskClock.start();
+}
+
 void MusicLrcManager::setLinearGradientColor(const MusicLrcColor &color)
 {
     QLinearGradient linearGradient;
@@ -271,9 +297,31 @@ void MusicLrcManager::setLinearGradientColor(const MusicLrcColor &color)
 
 void MusicLrcManager::setUpdateMask()
 {
-    //At a fixed period of time covered length increases.
-    m_lrcMaskWidth += m_lrcMaskWidthInterval;
-    update();
+    //Hidden label need not paint, mask is computed from clock when shown again
+    if(!isVisible())
+    {
+        return;
+    }
+
+    const int before = m_lrcMaskWidth;
+    m_lrcMaskWidth = lrcMaskWidth(lrcMaskElapsed());
+    const int after = m_lrcMaskWidth;
+    if(before == after)
+    {
+        return;
+    }
+
+    const float count = m_intervalCount;
+    updateIntervalCount();
+
+    if(before == 0 || count != m_intervalCount)
+    {
+        update();
+    }
+    else
+    {
+        update(lrcMaskRect(before, after));
+    }
 }
 
 void MusicLrcManager::setText(const QString &str)
@@ -281,3 +329,54 @@ void MusicLrcManager::setText(const QString &str)
     m_geometry.setX(MusicUtils::Widget::fontTextWidth(m_font, str));
     QLabel::setText(str);
 }
+
+qint64 MusicLrcManager::lrcMaskElapsed() const
+{
+    return m_lrcMaskPosition + (m_lrcMaskClock.isValid() ? m_lrcMaskClock.elapsed() : 0);
+}
+
+float MusicLrcManager::lrcMaskWidth(qint64 elapsed) const
+{
+    const float width = m_geometry.x();
+    if(m_lrcMaskWords.isEmpty())
+    {
+        return (m_lrcMaskDuration > 0) ? qMin(width, width * elapsed / m_lrcMaskDuration) : 0;
+    }
+
+    const QString &str = text();
+    const float total = MusicUtils::Widget::fontTextWidth(m_font, str);
+    if(total <= 0)
+    {
+        return 0;
+    }
+
+    int offset = 0;
+    for(const MusicLrcWordTime &word : qAsConst(m_lrcMaskWords))
+    {
+        if(elapsed < word.m_start)
+        {
+            break;
+        }
+
+        if(elapsed < word.m_start + word.m_duration)
+        {
+            const float before = MusicUtils::Widget::fontTextWidth(m_font, str.left(offset));
+            const float current = MusicUtils::Widget::fontTextWidth(m_font, str.mid(offset, word.m_length));
+            return (before + current * (elapsed - word.m_start) / word.m_duration) * width / total;
+        }
+        offset += word.m_length;
+    }
+
+    return (offset >= str.length()) ? width : MusicUtils::Widget::fontTextWidth(m_font, str.left(offset)) * width / total;
+}
+
+void MusicLrcManager::updateIntervalCount()
+{
+    //Scroll long text to keep the mask edge in the middle
+    m_intervalCount = qMin(0.0f, qMax(m_lrcPerWidth / 2.0f - m_lrcMaskWidth, float(m_lrcPerWidth - m_geometry.x())));
+}
+
+QRect MusicLrcManager::lrcMaskRect(int from, int to) const
+{
+    return QRect(m_lrcMaskOrigin + qMin(from, to) - 1, 0, qAbs(to - from) + 2, height());
+}
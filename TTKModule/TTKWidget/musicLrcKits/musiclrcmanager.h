@@ -23,7 +23,8 @@
 #include <QAction>
 #include <QPainter>
 #include <QMouseEvent>
-#include "musicglobaldefine.h"
+#include <QElapsedTimer>
+#include "musiclrcanalysis.h"
 #include "musicwidgetheaders.h"
 
 #define LRC_PER_TIME        30
@@ -98,13 +99,17 @@ public:
      */
     void startTimerClock();
     /*!
-     * Start timer clock to draw lrc mask.
+     * Start timer clock to draw lrc mask, use word times when available.
      */
-    void startLrcMask(qint64 intervaltime);
+    void startLrcMask(qint64 intervaltime, const MusicLrcWordTimes &words = MusicLrcWordTimes());
     /*!
      * Stop timer clock to draw lrc mask.
      */
     void stopLrcMask();
+    /*!
+     * Sync lrc mask clock to play position of current line.
+     */
+    void syncLrcMask(qint64 position);
     /*!
      * Set linear gradient color.
      */
@@ -174,12 +179,32 @@ public Q_SLOTS:
     void setText(const QString &str);
 
 protected:
+    /*!
+     * Get current lrc mask elapsed time.
+     */
+    qint64 lrcMaskElapsed() const;
+    /*!
+     * Get lrc mask width by elapsed time.
+     */
+    float lrcMaskWidth(qint64 elapsed) const;
+    /*!
+     * Update text scroll offset to keep mask in view.
+     */
+    void updateIntervalCount();
+    /*!
+     * Get dirty rect of mask changed from and to width.
+     */
+    virtual QRect lrcMaskRect(int from, int to) const;
+
     QLinearGradient m_linearGradient, m_maskLinearGradient;
     QFont m_font;
     QTimer *m_timer;
-    float m_lrcMaskWidth, m_lrcMaskWidthInterval, m_intervalCount;
+    QElapsedTimer m_lrcMaskClock;
+    MusicLrcWordTimes m_lrcMaskWords;
+    qint64 m_lrcMaskDuration, m_lrcMaskPosition;
+    float m_lrcMaskWidth, m_intervalCount;
 
-    int m_lrcPerWidth, m_transparent, m_speedLevel;
+    int m_lrcPerWidth, m_lrcMaskOrigin, m_transparent, m_speedLevel;
     QPoint m_geometry;
 
 };
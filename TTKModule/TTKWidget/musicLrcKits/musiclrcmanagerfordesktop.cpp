@@ -28,10 +28,7 @@ void MusicLrcManagerHorizontalDesktop::paintEvent(QPaintEvent *)
     m_linearGradient.setFinalStop(0, fontHeight);
     m_maskLinearGradient.setFinalStop(0, fontHeight);
 
-    if(m_geometry.x() + m_intervalCount >= m_lrcPerWidth && m_lrcMaskWidth >= m_lrcPerWidth / 2)
-    {
-        m_intervalCount -= m_lrcMaskWidthInterval;
-    }
+    m_lrcMaskOrigin = m_intervalCount;
 
     //Draw the underlying text, such as shadow, will make the effect more clearly,
     //and more texture
@@ -69,10 +66,7 @@ void MusicLrcManagerVerticalDesktop::paintEvent(QPaintEvent *)
     m_linearGradient.setFinalStop(0, fontHeight);
     m_maskLinearGradient.setFinalStop(0, fontHeight);
 
-    if(m_geometry.x() + m_intervalCount >= m_lrcPerWidth && m_lrcMaskWidth >= m_lrcPerWidth / 2)
-    {
-        m_intervalCount -= m_lrcMaskWidthInterval;
-    }
+    m_lrcMaskOrigin = m_intervalCount;
 
     painter.translate(m_geometry.y(), 0);
     painter.rotate(MA_90);
@@ -97,3 +91,8 @@ void MusicLrcManagerVerticalDesktop::paintEvent(QPaintEvent *)
     painter.drawText(m_intervalCount, 0, offsetValue, 60, Qt::AlignLeft, text());
     painter.translate(-m_geometry.y(), 0);
 }
+
+QRect MusicLrcManagerVerticalDesktop::lrcMaskRect(int from, int to) const
+{
+    return QRect(0, m_lrcMaskOrigin + qMin(from, to) - 1, width(), qAbs(to - from) + 2);
+}
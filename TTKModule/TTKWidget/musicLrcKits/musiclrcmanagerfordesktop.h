@@ -77,6 +77,10 @@ protected:
      * Override the widget event.
      */
     virtual void paintEvent(QPaintEvent *event) override;
+    /*!
+     * Override the lrc mask dirty rect.
+     */
+    virtual QRect lrcMaskRect(int from, int to) const override;
 
 };
 
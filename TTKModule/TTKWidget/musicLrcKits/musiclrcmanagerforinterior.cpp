@@ -29,15 +29,12 @@ void MusicLrcManagerForInterior::paintEvent(QPaintEvent *)
     m_linearGradient.setFinalStop(0, fontHeight);
     m_maskLinearGradient.setFinalStop(0, fontHeight);
 
-    if(m_geometry.x() + m_intervalCount >= m_lrcPerWidth && m_lrcMaskWidth >= m_lrcPerWidth / 2)
-    {
-        m_intervalCount -= m_lrcMaskWidthInterval;
-    }
     //Draw the underlying text, such as shadow, will make the effect more clearly, and more texture
     ttplus = 2.55*m_gradientTransparent;
     painter.setPen(QColor(0, 0, 0, ttplus));
 
     ttplus = (m_lrcPerWidth - m_geometry.x()) / 2.0;
+    m_lrcMaskOrigin = ttplus < 0 ? m_intervalCount : ttplus;
     painter.drawText((ttplus < 0 ? m_intervalCount : ttplus) + 1, 1,
                      m_geometry.x(), m_geometry.y(), Qt::AlignLeft | Qt::AlignVCenter, text());
 
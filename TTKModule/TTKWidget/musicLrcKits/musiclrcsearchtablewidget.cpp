@@ -50,7 +50,7 @@ void MusicLrcSearchTableWidget::musicDownloadLocal(int row)
     ///download lrc
     MusicAbstractDownLoadRequest *d = G_DOWNLOAD_QUERY_PTR->getDownloadLrcRequest(musicSongInfos[row].m_lrcUrl,
                                      MusicUtils::String::lrcPrefix() + m_networkRequest->getQueryText() + LRC_FILE,
-                                     MusicObject::DownloadLrc, this);
+                                     MusicObject::DownloadLrc, this, musicSongInfos[row].m_queryServer);
     connect(d, SIGNAL(downLoadDataChanged(QString)), SIGNAL(lrcDownloadStateChanged(QString)));
     d->startToDownload();
 }
@@ -7,6 +7,7 @@
 #include "musicmessagebox.h"
 #include "musicconnectionpool.h"
 #include "musicsongmeta.h"
+#include "musicsongmetascanner.h"
 #include "musicprogresswidget.h"
 #include "musicsongsearchonlinewidget.h"
 #include "musicsongchecktoolswidget.h"
@@ -14,6 +15,9 @@
 #include "musiclrcdownloadbatchwidget.h"
 #include "musicapplication.h"
 #include "musictoastlabel.h"
+#include "musicplayliststoremanager.h"
+
+#include <QEventLoop>
 
 #define  ITEM_MIN_COUNT             4
 #define  ITEM_MAX_COUNT             10
@@ -123,6 +127,7 @@ void MusicSongsSummariziedWidget::appendMusicLists(const MusicSongItems &names)
         item->m_itemIndex = ++m_itemIndexRaise;
         checkCurrentNameExist(item->m_itemName);
         createWidgetItem(item);
+        G_PLAYLIST_STORE_PTR->updateItem(m_songItems.count() - 1, *item);
     }
 }
 
@@ -133,32 +138,64 @@ void MusicSongsSummariziedWidget::importMusicSongsByPath(const QStringList &file
         m_musicSongSearchWidget->close();
     }
 
-    MusicProgressWidget progress;
-    progress.show();
-    progress.setTitle(tr("Import File Mode"));
-    progress.setRange(0, files.count());
-
     MusicSongItem *item = &m_songItems[m_currentImportIndex];
 
-    int i = 0;
+    QSet<QString> unique;
+    QStringList paths;
     for(const QString &path : qAsConst(files))
     {
-        if(item->m_songs.contains(MusicSong(path)))
+        if(item->containsSong(path) || unique.contains(path))
         {
             continue;
         }
 
-        item->m_songs << MusicObject::generateMusicSongList(path);
-        progress.setValue(++i);
+        unique.insert(path);
+        paths << path;
     }
+
+    MusicProgressWidget progress;
+    progress.show();
+    progress.setTitle(tr("Import File Mode"));
+    progress.setRange(0, paths.count());
+
+    MusicSongMetaScanner scanner;
+    connect(&scanner, SIGNAL(songsReady(MusicSongs)), SLOT(importMusicSongsReady(MusicSongs)));
+    connect(&scanner, SIGNAL(progressChanged(int)), &progress, SLOT(setValue(int)));
+    connect(&progress, SIGNAL(canceled()), &scanner, SLOT(cancel()));
+
+    QEventLoop loop;
+    connect(&scanner, SIGNAL(finished()), &loop, SLOT(quit()));
+    scanner.start(paths);
+    if(scanner.isRunning())
+    {
+        loop.exec();
+    }
+
+    item = &m_songItems[m_currentImportIndex];
     item->m_itemObject->updateSongsFileName(item->m_songs);
     setItemTitle(item);
+    G_PLAYLIST_STORE_PTR->updateItem(m_currentImportIndex, *item);
 
     MusicSongsToolBoxWidget::setCurrentIndex(m_currentImportIndex);
 
     MusicToastLabel::popup(tr("Import Music Songs Done!"));
 }
 
+void MusicSongsSummariziedWidget::importMusicSongsReady(const MusicSongs &songs)
+{
+    MusicSongItem *item = &m_songItems[m_currentImportIndex];
+    for(const MusicSong &song : qAsConst(songs))
+    {
+        if(!item->containsSong(song.getMusicPath()))
+        {
+            item->appendSongs(MusicSongs() << song);
+        }
+    }
+
+    item->m_itemObject->updateSongsFileName(item->m_songs);
+    setItemTitle(item);
+}
+
 QStringList MusicSongsSummariziedWidget::getMusicSongsFileName(int index) const
 {
     QStringList list;
@@ -198,15 +235,7 @@ int MusicSongsSummariziedWidget::mapSongIndexByFilePath(int toolIndex, const QSt
         return -1;
     }
 
-    const MusicSongs songs(m_songItems[toolIndex].m_songs);
-    for(int i=0; i<songs.count(); ++i)
-    {
-        if(MusicSong(path) == songs[i])
-        {
-            return i;
-        }
-    }
-    return -1;
+    return m_songItems[toolIndex].songIndex(path);
 }
 
 QString MusicSongsSummariziedWidget::mapFilePathBySongIndex(int toolIndex, int index) const
@@ -216,7 +245,7 @@ QString MusicSongsSummariziedWidget::mapFilePathBySongIndex(int toolIndex, int i
         return QString();
     }
 
-    const MusicSongs songs(m_songItems[toolIndex].m_songs);
+    const MusicSongs &songs = m_songItems[toolIndex].m_songs;
     if(index < 0 || index >= songs.count())
     {
         return QString();
@@ -378,6 +407,7 @@ void MusicSongsSummariziedWidget::deleteRowItem(int index)
     item = m_songItems.takeAt(id);
     removeItem(item.m_itemObject);
     delete item.m_itemObject;
+    G_PLAYLIST_STORE_PTR->removeItem(id);
 
     resetToolIndex();
 }
@@ -404,6 +434,7 @@ void MusicSongsSummariziedWidget::deleteRowItems()
         MusicSongItem item = m_songItems.takeLast();
         removeItem(item.m_itemObject);
         delete item.m_itemObject;
+        G_PLAYLIST_STORE_PTR->removeItem(i);
     }
 }
 
@@ -447,6 +478,7 @@ void MusicSongsSummariziedWidget::changRowItemName(int index, const QString &nam
     MusicSongItem *item = &m_songItems[id];
     item->m_itemName = name;
     setItemTitle(item);
+    G_PLAYLIST_STORE_PTR->updateItem(id, *item);
 }
 
 void MusicSongsSummariziedWidget::addNewFiles(int index)
@@ -511,6 +543,7 @@ void MusicSongsSummariziedWidget::swapDragItemIndex(int before, int after)
     swapItem(before, after);
     MusicSongItem item = m_songItems.takeAt(before);
     m_songItems.insert(after, item);
+    G_PLAYLIST_STORE_PTR->moveItem(before, after);
 
     resetToolIndex();
 }
@@ -599,7 +632,7 @@ void MusicSongsSummariziedWidget::musicListSongToLovestListAt(bool oper, int row
     MusicSongItem *item = &m_songItems[MUSIC_LOVEST_LIST];
 
     ///if current play list contains, call main add and remove function
-    if(MusicSong(MusicApplication::instance()->getCurrentFilePath()) == song)
+    if(MusicApplication::instance()->getCurrentFilePath() == song.getMusicPath())
     {
         MusicApplication::instance()->musicAddSongToLovestListAt(oper);
         return;
@@ -609,16 +642,20 @@ void MusicSongsSummariziedWidget::musicListSongToLovestListAt(bool oper, int row
     if(oper)    ///Add to lovest list
     {
         item->m_songs << song;
+        item->invalidateSongIndex();
         w->updateSongsFileName(item->m_songs);
         setItemTitle(item);
+        G_PLAYLIST_STORE_PTR->updateItem(MUSIC_LOVEST_LIST, *item);
     }
     else        ///Remove to lovest list
     {
         if(item->m_songs.removeOne(song))
         {
+            item->invalidateSongIndex();
             w->clearAllItems();
             w->updateSongsFileName(item->m_songs);
             setItemTitle(item);
+            G_PLAYLIST_STORE_PTR->updateItem(MUSIC_LOVEST_LIST, *item);
             MusicApplication::instance()->setLoveDeleteItemAt(song.getMusicPath(), m_currentPlayToolIndex == MUSIC_LOVEST_LIST);
         }
     }
@@ -637,16 +674,20 @@ void MusicSongsSummariziedWidget::musicSongToLovestListAt(bool oper, int row)
     if(oper)    ///Add to lovest list
     {
         item->m_songs << song;
+        item->invalidateSongIndex();
         w->updateSongsFileName(item->m_songs);
         setItemTitle(item);
+        G_PLAYLIST_STORE_PTR->updateItem(MUSIC_LOVEST_LIST, *item);
     }
     else        ///Remove to lovest list
     {
         if(item->m_songs.removeOne(song))
         {
+            item->invalidateSongIndex();
             w->clearAllItems();
             w->updateSongsFileName(item->m_songs);
             setItemTitle(item);
+            G_PLAYLIST_STORE_PTR->updateItem(MUSIC_LOVEST_LIST, *item);
             MusicApplication::instance()->setLoveDeleteItemAt(song.getMusicPath(), m_currentPlayToolIndex == MUSIC_LOVEST_LIST);
         }
     }
@@ -657,9 +698,10 @@ void MusicSongsSummariziedWidget::addNetMusicSongToList(const QString &name, con
     const QString &musicSong = MusicUtils::Algorithm::mdII(name, ALG_ARC_KEY, false);
     const QString &path = QString("%1%2.%3").arg(CACHE_DIR_FULL).arg(name).arg(format);
     MusicSongItem *item = &m_songItems[MUSIC_NETWORK_LIST];
-    item->m_songs << MusicSong(path, 0, time, musicSong);
+    item->appendSongs(MusicSongs() << MusicSong(path, 0, time, musicSong));
     item->m_itemObject->updateSongsFileName(item->m_songs);
     setItemTitle(item);
+    G_PLAYLIST_STORE_PTR->updateItem(MUSIC_NETWORK_LIST, *item);
 
     if(play)
     {
@@ -680,13 +722,10 @@ void MusicSongsSummariziedWidget::addSongToPlaylist(const QStringList &items)
     importMusicSongsByPath(files);
 
     const MusicSongItem *songItem = &m_songItems[MUSIC_NORMAL_LIST];
-    const MusicSongs *musicSongs = &songItem->m_songs;
-    const MusicSong &song = MusicSong(items.last());
-
-    int index = musicSongs->count() - 1;
-    if(musicSongs->contains(song))
+    int index = songItem->songIndex(items.last());
+    if(index == -1)
     {
-        index = musicSongs->indexOf(song);
+        index = songItem->m_songs.count() - 1;
     }
 
     /// just play it at once
@@ -707,6 +746,7 @@ void MusicSongsSummariziedWidget::setDeleteItemAt(const TTKIntList &index, bool
     for(int i=index.count() - 1; i>=0; --i)
     {
         const MusicSong &song = item->m_songs.takeAt(index[i]);
+        item->invalidateSongIndex();
         deleteFiles << song.getMusicPath();
         if(currentIndex != m_currentPlayToolIndex && currentIndex == MUSIC_LOVEST_LIST)
         {
@@ -730,6 +770,7 @@ void MusicSongsSummariziedWidget::setDeleteItemAt(const TTKIntList &index, bool
     MusicApplication::instance()->setDeleteItemAt(deleteFiles, fileRemove, currentIndex == m_currentPlayToolIndex, currentIndex);
 
     setItemTitle(item);
+    G_PLAYLIST_STORE_PTR->updateItem(currentIndex, *item);
 
     //create upload file widget if current items is all been deleted
     TTKStatic_cast(MusicSongsListTableWidget*, item->m_itemObject)->createUploadFileModule();
@@ -760,7 +801,9 @@ void MusicSongsSummariziedWidget::setMusicIndexSwaped(int before, int after, int
 #endif
         }
     }
+    m_songItems[m_currentIndex].invalidateSongIndex();
     songs = *names;
+    G_PLAYLIST_STORE_PTR->updateItem(m_currentIndex, m_songItems[m_currentIndex]);
 
     if(m_currentIndex == m_currentPlayToolIndex)
     {
@@ -791,6 +834,7 @@ void MusicSongsSummariziedWidget::setMusicPlayCount(int index)
     {
         MusicSong *song = &(*songs)[index];
         song->setMusicPlayCount(song->getMusicPlayCount() + 1);
+        G_PLAYLIST_STORE_PTR->updateSong(m_currentPlayToolIndex, index, *song);
     }
 }
 
@@ -821,10 +865,12 @@ void MusicSongsSummariziedWidget::setRecentMusicSongs(int index)
 
         music.setMusicPlayCount(music.getMusicPlayCount() + 1);
         musics->append(music);
+        item->invalidateSongIndex();
         w->updateSongsFileName(*musics);
 
         const QString title(QString("%1[%2]").arg(item->m_itemName).arg(musics->count()));
         setTitle(w, title);
+        G_PLAYLIST_STORE_PTR->updateItem(MUSIC_RECENT_LIST, *item);
     }
     else
     {
@@ -834,6 +880,7 @@ void MusicSongsSummariziedWidget::setRecentMusicSongs(int index)
             if(music == *song)
             {
                 song->setMusicPlayCount(song->getMusicPlayCount() + 1);
+                G_PLAYLIST_STORE_PTR->updateSong(MUSIC_RECENT_LIST, i, *song);
                 break;
             }
         }
@@ -892,7 +939,7 @@ void MusicSongsSummariziedWidget::musicListSongSortBy(int index)
     }
 
     MusicSongs *songs = &m_songItems[id].m_songs;
-    const MusicSong oMusicSong(MusicApplication::instance()->getCurrentFilePath());
+    const QString &currentPath = MusicApplication::instance()->getCurrentFilePath();
 
     for(int i=0; i<songs->count(); ++i)
     {
@@ -907,17 +954,30 @@ void MusicSongsSummariziedWidget::musicListSongSortBy(int index)
     {
         std::sort(songs->begin(), songs->end(), std::greater<MusicSong>());
     }
+    m_songItems[id].invalidateSongIndex();
+    G_PLAYLIST_STORE_PTR->updateItem(id, m_songItems[id]);
 
     w->clearAllItems();
     w->setSongsFileName(songs);
 
-    index = songs->indexOf(oMusicSong);
+    index = m_songItems[id].songIndex(currentPath);
     if(m_currentIndex == m_currentPlayToolIndex)
     {
         MusicApplication::instance()->musicPlaySort(index);
     }
 }
 
+void MusicSongsSummariziedWidget::musicListSongNameChanged(int index, int row)
+{
+    const int id = foundMappingIndex(index);
+    if(id == -1 || row < 0 || row >= m_songItems[id].m_songs.count())
+    {
+        return;
+    }
+
+    G_PLAYLIST_STORE_PTR->updateSong(id, row, m_songItems[id].m_songs[row]);
+}
+
 void MusicSongsSummariziedWidget::musicSearchWidget()
 {
     if(m_musicSongSearchWidget == nullptr)
@@ -981,6 +1041,7 @@ void MusicSongsSummariziedWidget::addNewRowItem(const QString &name)
     item.m_itemName = name;
     m_songItems << item;
     createWidgetItem(&m_songItems.last());
+    G_PLAYLIST_STORE_PTR->updateItem(m_songItems.count() - 1, m_songItems.last());
 }
 
 void MusicSongsSummariziedWidget::createWidgetItem(MusicSongItem *item)
@@ -1004,6 +1065,7 @@ void MusicSongsSummariziedWidget::createWidgetItem(MusicSongItem *item)
     connect(w, SIGNAL(musicListSongToLovestListAt(bool,int)), SLOT(musicListSongToLovestListAt(bool,int)));
     connect(w, SIGNAL(showFloatWidget()), SLOT(showFloatWidget()));
     connect(w, SIGNAL(musicListSongSortBy(int)), SLOT(musicListSongSortBy(int)));
+    connect(w, SIGNAL(musicListSongNameChanged(int,int)), SLOT(musicListSongNameChanged(int,int)));
 
     ///connect to items
     setInputObject(m_itemList.last().m_widgetItem);
@@ -233,6 +233,10 @@ public Q_SLOTS:
      * Music list songs sort by type.
      */
     void musicListSongSortBy(int index);
+    /*!
+     * Music list song name changed by row.
+     */
+    void musicListSongNameChanged(int index, int row);
 
 private Q_SLOTS:
     /*!
@@ -247,6 +251,10 @@ private Q_SLOTS:
      * Delete the float function widget.
      */
     void deleteFloatWidget();
+    /*!
+     * Scanned import songs batch is ready.
+     */
+    void importMusicSongsReady(const MusicSongs &songs);
 
 protected:
     /*!
@@ -98,11 +98,14 @@ MusicLocalSongsManagerWidget::MusicLocalSongsManagerWidget(QWidget *parent)
 #endif
 
     m_runTypeChanged = false;
+    m_userScan = false;
     addDrivesList();
     m_ui->filterComboBox->setCurrentIndex(-1);
 
     m_thread = new MusicLocalSongsManagerThread(this);
     connect(m_thread, SIGNAL(setSongNamePath(QFileInfoList)), SLOT(setSongNamePath(QFileInfoList)));
+    connect(m_thread, SIGNAL(searchFilePathChanged(QFileInfoList)), SLOT(searchFilePathChanged(QFileInfoList)));
+    connect(m_thread, SIGNAL(started()), SLOT(searchFileStarted()));
 
     G_CONNECTION_PTR->setValue(getClassName(), this);
     G_CONNECTION_PTR->poolConnect(getClassName(), MusicSongsSummariziedWidget::getClassName());
@@ -212,10 +215,64 @@ void MusicLocalSongsManagerWidget::setSongNamePath(const QFileInfoList &name)
     TTK_LOGGER_INFO("stop fetch");
     loadingLabelState(false);
 
+    const bool userScan = m_userScan;
+    m_userScan = false;
+    if(!userScan && !isSongListShown())
+    {
+        ///rescan by watcher, the list is rebuilt from files when it is shown again
+        m_ui->songlistsTable->setFiles(name);
+        return;
+    }
+
+    ///all files are already shown while searching
+    if(m_ui->stackedWidget->currentIndex() == LOCAL_MANAGER_INDEX_0 && m_ui->searchLineEdit->text().isEmpty() &&
+       m_ui->songlistsTable->rowCount() == name.count() && m_fileNames.count() == name.count())
+    {
+        m_ui->songlistsTable->setFiles(name);
+        m_fileNames = name;
+        return;
+    }
+
     m_ui->songlistsTable->setFiles(name);
     setShowlistButton();
 }
 
+void MusicLocalSongsManagerWidget::searchFilePathChanged(const QFileInfoList &name)
+{
+    if(m_runTypeChanged || m_ui->stackedWidget->currentIndex() != LOCAL_MANAGER_INDEX_0 || !m_ui->searchLineEdit->text().isEmpty())
+    {
+        return;
+    }
+
+    m_ui->songlistsTable->appendItems(name);
+    m_fileNames = m_ui->songlistsTable->getFiles();
+    m_ui->songCountLabel->setText(tr("showSongCount%1").arg(m_fileNames.count()));
+}
+
+void MusicLocalSongsManagerWidget::searchFileStarted()
+{
+    if(m_runTypeChanged)
+    {
+        return;
+    }
+
+    ///only scans started by user switch to the song list
+    if(m_userScan)
+    {
+        m_ui->stackedWidget->setCurrentIndex(LOCAL_MANAGER_INDEX_0);
+        controlEnabled(true);
+    }
+    else if(!isSongListShown())
+    {
+        return;
+    }
+
+    ///songs of the previous scan must go with their rows
+    m_ui->songlistsTable->clear();
+    m_ui->songlistsTable->setFiles(QFileInfoList());
+    m_fileNames.clear();
+}
+
 void MusicLocalSongsManagerWidget::filterScanChanged(int index)
 {
     TTK_LOGGER_INFO("start fetch");
@@ -237,6 +294,7 @@ void MusicLocalSongsManagerWidget::filterScanChanged(int index)
     }
 
     loadingLabelState(true);
+    m_userScan = true;
     m_thread->start();
 }
 
@@ -269,6 +327,11 @@ void MusicLocalSongsManagerWidget::updateFileLists(const QFileInfoList &list)
     addAllItems(m_fileNames);
 }
 
+bool MusicLocalSongsManagerWidget::isSongListShown() const
+{
+    return m_ui->stackedWidget->currentIndex() == LOCAL_MANAGER_INDEX_0 && m_ui->searchLineEdit->text().isEmpty();
+}
+
 void MusicLocalSongsManagerWidget::setShowlistButton()
 {
     m_runTypeChanged = false;
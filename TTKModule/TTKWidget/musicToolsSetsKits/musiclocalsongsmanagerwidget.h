@@ -82,6 +82,14 @@ public Q_SLOTS:
      * Send the searched file or path.
      */
     void setSongNamePath(const QFileInfoList &name);
+    /*!
+     * Send the searched file or path batch.
+     */
+    void searchFilePathChanged(const QFileInfoList &name);
+    /*!
+     * Start to receive the searched file or path batch.
+     */
+    void searchFileStarted();
     /*!
      * Start to fetch file or files.
      */
@@ -145,8 +153,12 @@ protected:
      * Loading label disable.
      */
     void loadingLabelState(bool state);
+    /*!
+     * Check all scanned songs are shown in list.
+     */
+    bool isSongListShown() const;
 
-    bool m_runTypeChanged;
+    bool m_runTypeChanged, m_userScan;
     Ui::MusicLocalSongsManagerWidget *m_ui;
     QFileInfoList m_fileNames;
     MusicLocalSongsManagerThread *m_thread;
@@ -36,33 +36,47 @@ void MusicLocalSongsTableWidget::clear()
 }
 
 void MusicLocalSongsTableWidget::addItems(const QFileInfoList &path)
+{
+    createItems(0, path);
+}
+
+void MusicLocalSongsTableWidget::appendItems(const QFileInfoList &path)
+{
+    const int count = rowCount();
+    setRowCount(count + path.count());
+    m_fileNames << path;
+    createItems(count, path);
+}
+
+void MusicLocalSongsTableWidget::createItems(int offset, const QFileInfoList &path)
 {
     QHeaderView *headerview = horizontalHeader();
     for(int i=0; i<path.count(); i++)
     {
+        const int row = offset + i;
         QTableWidgetItem *item = new QTableWidgetItem;
         item->setToolTip(path[i].fileName());
         item->setText(MusicUtils::Widget::elidedText(font(), item->toolTip(), Qt::ElideRight, headerview->sectionSize(0) - 20));
         item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-        setItem(i, 0, item);
+        setItem(row, 0, item);
 
                          item = new QTableWidgetItem;
         item->setToolTip(MusicUtils::Number::size2Label(path[i].size()));
         item->setText(MusicUtils::Widget::elidedText(font(), item->toolTip(), Qt::ElideRight, headerview->sectionSize(1) - 15));
         item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
-        setItem(i, 1, item);
+        setItem(row, 1, item);
 
                          item = new QTableWidgetItem(path[i].lastModified().date().toString(Qt::ISODate));
         item->setTextAlignment(Qt::AlignCenter);
-        setItem(i, 2, item);
+        setItem(row, 2, item);
 
                          item = new QTableWidgetItem;
         item->setIcon(QIcon(":/contextMenu/btn_audition"));
-        setItem(i, 3, item);
+        setItem(row, 3, item);
 
                          item = new QTableWidgetItem;
         item->setIcon(QIcon(":/contextMenu/btn_add"));
-        setItem(i, 4, item);
+        setItem(row, 4, item);
 
         m_musicSongs->append(MusicSong(path[i].absoluteFilePath()));
     }
@@ -43,6 +43,10 @@ public:
      * Add show list items.
      */
     void addItems(const QFileInfoList &path);
+    /*!
+     * Append show list items and files.
+     */
+    void appendItems(const QFileInfoList &path);
     /*!
      * Set files container.
      */
@@ -63,6 +67,11 @@ public Q_SLOTS:
     virtual void contextMenuEvent(QContextMenuEvent *event) override;
 
 protected:
+    /*!
+     * Create show list items from given row.
+     */
+    void createItems(int offset, const QFileInfoList &path);
+
     QFileInfoList m_fileNames;
 
 };
@@ -396,6 +396,8 @@ void MusicScreenSaverWidget::initialize()
         MusicDownloadQueueData nailData;
         nailData.m_url = url + OS_WALLNAIL_NAME;
         nailData.m_savePath = path + OS_WALLNAIL_NAME;
+        ///thumbnails fill the gallery, fetch them before the wallpapers
+        nailData.m_priority = 1;
         datas << nailData;
     }
 
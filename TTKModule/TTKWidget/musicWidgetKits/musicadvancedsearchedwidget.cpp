@@ -183,6 +183,7 @@ void MusicAdvancedSearchedWidget::updateServerPlaceholderText()
     switch(TTKStatic_cast(DownloadQueryServer, G_SETTING_PTR->value(MusicSettingManager::DownloadServer).toInt()))
     {
         case WYQueryServer:
+        case FederatedQueryServer:
             {
                 m_songEdit->setPlaceholderText(MusicUtils::Algorithm::mdII(WY_SG_SHARE, ALG_UNIMP_KEY, false).arg("28830412"));
                 m_artistEdit->setPlaceholderText(MusicUtils::Algorithm::mdII(WY_AR_SHARE, ALG_UNIMP_KEY, false).arg("964486"));
@@ -228,6 +229,7 @@ QString MusicAdvancedSearchedWidget::getSearchedKeyWork(int type, const QString
     switch(TTKStatic_cast(DownloadQueryServer, G_SETTING_PTR->value(MusicSettingManager::DownloadServer).toInt()))
     {
         case WYQueryServer:
+        case FederatedQueryServer:
             {
                 QRegExp regx("id=(\\d+)");
                 key = (url.indexOf(regx) != -1) ? regx.cap(1) : url;
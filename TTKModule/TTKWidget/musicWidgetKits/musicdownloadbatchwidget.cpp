@@ -4,6 +4,7 @@
 #include "musicsettingmanager.h"
 #include "musicdownloadrecordconfigmanager.h"
 #include "musicdownloadtagdatarequest.h"
+#include "musicnumberutils.h"
 
 #include <QTimer>
 #include <QScrollBar>
@@ -126,6 +127,25 @@ void MusicDownloadBatchTableItem::setCurrentQuality(int bitrate)
     }
 }
 
+void MusicDownloadBatchTableItem::updateItemSize(const QString &url, const QString &size)
+{
+    for(int i=0; i<m_qulity->count(); ++i)
+    {
+        MusicObject::MusicSongAttribute attr = m_qulity->itemData(i).value<MusicObject::MusicSongAttribute>();
+        if(attr.m_url != url || (!attr.m_size.isEmpty() && attr.m_size != STRING_NULL))
+        {
+            continue;
+        }
+
+        attr.m_size = size;
+        m_qulity->setItemData(i, QVariant::fromValue<MusicObject::MusicSongAttribute>(attr));
+        if(i == m_qulity->currentIndex())
+        {
+            currentQualityChanged(i);
+        }
+    }
+}
+
 void MusicDownloadBatchTableItem::currentQualityChanged(int index)
 {
     if(index < 0)
@@ -296,6 +316,14 @@ void MusicDownloadBatchTableWidget::startToDownload(MusicAbstractQueryRequest::Q
     }
 }
 
+void MusicDownloadBatchTableWidget::updateItemSize(const QString &url, const QString &size)
+{
+    for(MusicDownloadBatchTableItem *item : qAsConst(m_items))
+    {
+        item->updateItemSize(url, size);
+    }
+}
+
 void MusicDownloadBatchTableWidget::itemCellClicked(int row, int column)
 {
     Q_UNUSED(row);
@@ -356,6 +384,8 @@ MusicDownloadBatchWidget::MusicDownloadBatchWidget(QWidget *parent)
     m_ui->qualityBox->setCurrentIndex(0);
 
     m_queryType = MusicAbstractQueryRequest::MusicQuery;
+    m_sizeProbe = new MusicUrlSizeProbe(this);
+    connect(m_sizeProbe, SIGNAL(sizeChanged(QString,qint64)), SLOT(urlFileSizeChanged(QString,qint64)));
 
     m_ui->tableWidget->setParentClass(this);
     m_ui->downloadButton->setStyleSheet(MusicUIObject::MQSSPushButtonStyle06);
@@ -377,11 +407,22 @@ void MusicDownloadBatchWidget::setSongName(const MusicObject::MusicSongInformati
 {
     m_queryType = type;
 
+    QStringList urls;
     for(const MusicObject::MusicSongInformation &info : qAsConst(infos))
     {
         m_ui->tableWidget->createItem(info);
+        for(const MusicObject::MusicSongAttribute &attr : qAsConst(info.m_songAttrs))
+        {
+            if(attr.m_size.isEmpty() || attr.m_size == STRING_NULL)
+            {
+                urls << attr.m_url;
+            }
+        }
     }
     m_ui->songCountLabel->setText(tr("All Songs Count %1").arg(infos.count()));
+
+    ///sizes may still be probed by the search, probed ones come from cache
+    m_sizeProbe->probe(urls);
 }
 
 void MusicDownloadBatchWidget::show()
@@ -395,3 +436,8 @@ void MusicDownloadBatchWidget::startToDownload()
     m_ui->tableWidget->startToDownload(m_queryType);
     hide();
 }
+
+void MusicDownloadBatchWidget::urlFileSizeChanged(const QString &url, qint64 size)
+{
+    m_ui->tableWidget->updateItemSize(url, MusicUtils::Number::size2Label(size));
+}
@@ -53,6 +53,10 @@ public:
      * Set current quality.
      */
     void setCurrentQuality(int bitrate);
+    /*!
+     * Update the size of quality by url if it is unknown.
+     */
+    void updateItemSize(const QString &url, const QString &size);
 
 public Q_SLOTS:
     /*!
@@ -108,6 +112,10 @@ public:
      * Start to download music data.
      */
     void startToDownload(MusicAbstractQueryRequest::QueryType type);
+    /*!
+     * Update the size of items by url if it is unknown.
+     */
+    void updateItemSize(const QString &url, const QString &size);
 
 public Q_SLOTS:
     /*!
@@ -160,8 +168,15 @@ public Q_SLOTS:
      */
     void startToDownload();
 
+private Q_SLOTS:
+    /*!
+     * Url file size probed, fill in the size of items.
+     */
+    void urlFileSizeChanged(const QString &url, qint64 size);
+
 protected:
     Ui::MusicDownloadBatchWidget *m_ui;
+    MusicUrlSizeProbe *m_sizeProbe;
 
     MusicAbstractQueryRequest::QueryType m_queryType;
 };
@@ -7,6 +7,7 @@
 #include "musictoastlabel.h"
 #include "musicdownloadqueryfactory.h"
 #include "musicstringutils.h"
+#include "musicnumberutils.h"
 #include "musicfileutils.h"
 #include "musicwidgetheaders.h"
 
@@ -78,6 +79,7 @@ void MusicDownloadTableWidget::createItem(const MusicObject::MusicSongAttribute
     QTableWidgetItem *it = new QTableWidgetItem;
     MusicDownloadTableItemRole role(attr.m_bitrate, attr.m_format, attr.m_size);
     it->setData(TABLE_ITEM_ROLE, QVariant::fromValue<MusicDownloadTableItemRole>(role));
+    it->setData(TABLE_ITEM_URL_ROLE, attr.m_url);
     setItem(index, 0,  it);
 
     MusicDownloadTableItem *item = new MusicDownloadTableItem(this);
@@ -100,6 +102,33 @@ MusicDownloadTableItemRole MusicDownloadTableWidget::getCurrentItemRole() const
    return item(row, 0)->data(TABLE_ITEM_ROLE).value<MusicDownloadTableItemRole>();
 }
 
+void MusicDownloadTableWidget::updateItemSize(const QString &url, const QString &size)
+{
+    for(int i=0; i<rowCount(); ++i)
+    {
+        QTableWidgetItem *it = item(i, 0);
+        if(!it || it->data(TABLE_ITEM_URL_ROLE).toString() != url)
+        {
+            continue;
+        }
+
+        MusicDownloadTableItemRole role = it->data(TABLE_ITEM_ROLE).value<MusicDownloadTableItemRole>();
+        if(!role.m_size.isEmpty() && role.m_size != STRING_NULL)
+        {
+            continue;
+        }
+
+        role.m_size = size;
+        it->setData(TABLE_ITEM_ROLE, QVariant::fromValue<MusicDownloadTableItemRole>(role));
+
+        MusicDownloadTableItem *item = TTKObject_cast(MusicDownloadTableItem*, cellWidget(i, 0));
+        if(item)
+        {
+            item->setInformation(QString("%1/%2KBPS/%3").arg(role.m_size).arg(role.m_bitrate).arg(role.m_format.toUpper()));
+        }
+    }
+}
+
 void MusicDownloadTableWidget::itemCellClicked(int row, int column)
 {
     Q_UNUSED(row);
@@ -134,6 +163,7 @@ MusicDownloadWidget::MusicDownloadWidget(QWidget *parent)
 
     m_querySingleInfo = false;
     m_networkRequest = G_DOWNLOAD_QUERY_PTR->getQueryRequest(this);
+    m_sizeProbe = new MusicUrlSizeProbe(this);
 
     m_queryType = MusicAbstractQueryRequest::MusicQuery;
     m_ui->loadingLabel->setType(MusicGifLabelWidget::Gif_Cicle_Blue);
@@ -142,6 +172,8 @@ MusicDownloadWidget::MusicDownloadWidget(QWidget *parent)
     connect(m_ui->topTitleCloseButton, SIGNAL(clicked()), SLOT(close()));
     connect(m_ui->downloadButton, SIGNAL(clicked()), SLOT(startToDownload()));
     connect(m_networkRequest, SIGNAL(downLoadDataChanged(QString)), SLOT(queryAllFinished()));
+    connect(m_networkRequest, SIGNAL(urlFileSizeProbed(QString,qint64)), SLOT(urlFileSizeChanged(QString,qint64)));
+    connect(m_sizeProbe, SIGNAL(sizeChanged(QString,qint64)), SLOT(urlFileSizeChanged(QString,qint64)));
 }
 
 MusicDownloadWidget::~MusicDownloadWidget()
@@ -201,6 +233,17 @@ void MusicDownloadWidget::setSongName(const MusicObject::MusicSongInformation &i
     {
         queryAllFinishedMovie(info.m_songAttrs);
     }
+
+    ///sizes may still be probed by the search, probed ones come from cache
+    QStringList urls;
+    for(const MusicObject::MusicSongAttribute &attr : qAsConst(info.m_songAttrs))
+    {
+        if(attr.m_size.isEmpty() || attr.m_size == STRING_NULL)
+        {
+            urls << attr.m_url;
+        }
+    }
+    m_sizeProbe->probe(urls);
 }
 
 void MusicDownloadWidget::show()
@@ -416,6 +459,21 @@ void MusicDownloadWidget::dataDownloadFinished()
     close();
 }
 
+void MusicDownloadWidget::urlFileSizeChanged(const QString &url, qint64 size)
+{
+    ///same label as the query request, so that the item still matches its attribute
+    const QString &label = MusicUtils::Number::size2Label(size);
+    m_ui->viewArea->updateItemSize(url, label);
+
+    for(MusicObject::MusicSongAttribute &attr : m_singleSongInfo.m_songAttrs)
+    {
+        if(attr.m_url == url && (attr.m_size.isEmpty() || attr.m_size == STRING_NULL))
+        {
+            attr.m_size = label;
+        }
+    }
+}
+
 void MusicDownloadWidget::startToDownloadMusic()
 {
     const MusicObject::MusicSongInformation musicSongInfo(getMatchMusicSongInformation());
@@ -29,7 +29,8 @@ class MusicDownloadWidget;
 
 class QLabel;
 
-#define TABLE_ITEM_ROLE Qt::UserRole + 1
+#define TABLE_ITEM_ROLE     Qt::UserRole + 1
+#define TABLE_ITEM_URL_ROLE Qt::UserRole + 2
 
 /*! @brief The class of the music song atrribute.
  * @author Greedysky <greedysky@163.com>
@@ -122,6 +123,10 @@ public:
      * Get current bitrate from item.
      */
     MusicDownloadTableItemRole getCurrentItemRole() const;
+    /*!
+     * Update the size of item by url if it is unknown.
+     */
+    void updateItemSize(const QString &url, const QString &size);
 
 public Q_SLOTS:
     /*!
@@ -184,6 +189,10 @@ public Q_SLOTS:
      * Data download is finished.
      */
     void dataDownloadFinished();
+    /*!
+     * Url file size probed, fill in the size of item.
+     */
+    void urlFileSizeChanged(const QString &url, qint64 size);
 
 protected:
     /*!
@@ -247,6 +256,7 @@ protected:
     Ui::MusicDownloadWidget *m_ui;
     bool m_querySingleInfo;
     MusicAbstractQueryRequest *m_networkRequest;
+    MusicUrlSizeProbe *m_sizeProbe;
     MusicAbstractQueryRequest::QueryType m_queryType;
     MusicObject::MusicSongInformation m_singleSongInfo;
 
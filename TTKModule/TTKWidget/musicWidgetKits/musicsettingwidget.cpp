@@ -4,6 +4,8 @@
 #include "musicstringutils.h"
 #include "musicnetworkproxy.h"
 #include "musicnetworkoperator.h"
+#include "musicnetworkcache.h"
+#include "musicdownloadcachemanager.h"
 #include "musicnetworkconnectiontestwidget.h"
 #include "musictoastlabel.h"
 #include "musichotkeymanager.h"
@@ -337,6 +339,9 @@ void MusicSettingWidget::downloadCachedClean()
     MusicUtils::File::removeRecursively(CACHE_DIR_FULL, false);
     MusicUtils::File::removeRecursively(ART_DIR_FULL, false);
     MusicUtils::File::removeRecursively(BACKGROUND_DIR_FULL, false);
+    G_NETWORK_CACHE_PTR->clear();
+    G_DOWNLOAD_CACHE_PTR->removeByDir(CACHE_DIR_FULL);
+    G_DOWNLOAD_CACHE_PTR->removeByDir(ART_DIR_FULL);
 }
 
 void MusicSettingWidget::downloadGroupCached(int index)
@@ -610,6 +615,7 @@ void MusicSettingWidget::saveResults()
     G_SETTING_PTR->setValue(MusicSettingManager::DownloadServer, m_ui->downloadServerComboBox->currentIndex());
     G_SETTING_PTR->setValue(MusicSettingManager::DownloadDLoadLimit, m_ui->downloadLimitSpeedComboBox->currentText());
     G_SETTING_PTR->setValue(MusicSettingManager::DownloadULoadLimit, m_ui->uploadLimitSpeedComboBox->currentText());
+    G_DOWNLOAD_CACHE_PTR->checkCacheSize();
 
 
     QmmpSettings *qmmpSettings = QmmpSettings::instance();
@@ -873,6 +879,7 @@ void MusicSettingWidget::initDownloadWidget()
     m_ui->downloadServerComboBox->addItem(QIcon(":/server/lb_qq"), tr("qqMusic"));
     m_ui->downloadServerComboBox->addItem(QIcon(":/server/lb_kuwo"), tr("kuwoMusic"));
     m_ui->downloadServerComboBox->addItem(QIcon(":/server/lb_kugou"), tr("kugouMusic"));
+    m_ui->downloadServerComboBox->addItem(tr("allMusic"));
 
     connect(m_ui->downloadCacheCleanButton, SIGNAL(clicked()), SLOT(downloadCachedClean()));
     //
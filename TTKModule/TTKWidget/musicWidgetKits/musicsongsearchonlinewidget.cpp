@@ -6,6 +6,7 @@
 #include "musicsettingmanager.h"
 #include "musicconnectionpool.h"
 #include "musicdownloaddatarequest.h"
+#include "musicsongprefetcher.h"
 #include "musicdownloadqueryfactory.h"
 #include "musicrightareawidget.h"
 #include "musicgiflabelwidget.h"
@@ -350,13 +351,14 @@ void MusicSongSearchTableWidget::addSearchMusicToPlaylist(int row)
     const QString &musicSong = item(row, 2)->toolTip() + " - " + item(row, 1)->toolTip();
     const QString &musicEnSong = MusicUtils::Algorithm::mdII(musicSong, ALG_ARC_KEY, true);
     const QString &downloadName = QString("%1%2.%3").arg(CACHE_DIR_FULL).arg(musicEnSong).arg(musicSongAttr.m_format);
+    MusicSongPrefetcher::addSource(downloadName, musicSongAttr.m_url);
 
     MusicDownloadDataRequest *download = new MusicDownloadDataRequest(musicSongAttr.m_url, downloadName, MusicObject::DownloadMusic, this);
     connect(download, SIGNAL(downLoadDataChanged(QString)), SLOT(searchDataDwonloadFinished()));
     download->startToDownload();
 
     G_DOWNLOAD_QUERY_PTR->getDownloadSmallPictureRequest(musicSongInfo.m_smallPicUrl, ART_DIR_FULL + musicSongInfo.m_singerName + SKN_FILE,
-                                                    MusicObject::DownloadSmallBackground, this)->startToDownload();
+                                                    MusicObject::DownloadSmallBackground, this, musicSongInfo.m_queryServer)->startToDownload();
     ///download big picture
     G_DOWNLOAD_QUERY_PTR->getDownloadBigPictureRequest(musicSongInfo.m_singerName, musicSongInfo.m_singerName, this)->startToDownload();
 
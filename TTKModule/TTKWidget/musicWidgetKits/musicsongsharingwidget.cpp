@@ -113,7 +113,8 @@ void MusicSongSharingWidget::confirmButtonClicked()
                 if(!d->isEmpty())
                 {
                     const MusicObject::MusicSongInformation info(d->getMusicSongInfos().first());
-                    QString server = d->getQueryServer();
+                    ///federated results keep the server each song comes from
+                    QString server = info.m_queryServer.isEmpty() ? d->getQueryServer() : info.m_queryServer;
                     if(server == QUERY_WY_INTERFACE)
                         server = MusicUtils::Algorithm::mdII(WY_SG_SHARE, ALG_UNIMP_KEY, false).arg(info.m_songId);
                     else if(server == QUERY_QQ_INTERFACE)
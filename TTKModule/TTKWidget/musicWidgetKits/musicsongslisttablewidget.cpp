@@ -90,60 +90,25 @@ void MusicSongsListTableWidget::updateSongsFileName(const MusicSongs &songs)
         return;
     }
 
-    const int count = rowCount();
+    ///items are created when the row is first painted
     setRowCount(songs.count());
-    QHeaderView *headerview = horizontalHeader();
-    for(int i=count; i<songs.count(); i++)
-    {
-        QTableWidgetItem *item = new QTableWidgetItem;
-        setItem(i, 0, item);
-                          item = new QTableWidgetItem;
-        item->setText(MusicUtils::Widget::elidedText(font(), songs[i].getMusicName(), Qt::ElideRight, headerview->sectionSize(1) - 10));
-#if TTK_QT_VERSION_CHECK(5,13,0)
-        item->setForeground(QColor(MusicUIObject::MQSSColor01));
-#else
-        item->setTextColor(QColor(MusicUIObject::MQSSColor01));
-#endif
-        item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-        setItem(i, 1, item);
-
-                          item = new QTableWidgetItem;
-        setItem(i, 2, item);
-
-                          item = new QTableWidgetItem;
-        setItem(i, 3, item);
-
-                          item = new QTableWidgetItem;
-        setItem(i, 4, item);
-
-                          item = new QTableWidgetItem(songs[i].getMusicPlayTime());
-#if TTK_QT_VERSION_CHECK(5,13,0)
-        item->setForeground(QColor(MusicUIObject::MQSSColor01));
-#else
-        item->setTextColor(QColor(MusicUIObject::MQSSColor01));
-#endif
-        item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-        setItem(i, 5, item);
-    }
     //just fix table widget size hint
     setFixedHeight(totalHeight());
 }
 
 void MusicSongsListTableWidget::clearAllItems()
 {
-    if(m_playRowIndex < 0)
+    if(m_playRowIndex >= 0)
     {
-        return;
-    }
-
-    //Remove play widget
-    setRowHeight(m_playRowIndex, ITEM_ROW_HEIGHT_M);
-    removeCellWidget(m_playRowIndex, 0);
+        //Remove play widget
+        setRowHeight(m_playRowIndex, ITEM_ROW_HEIGHT_M);
+        removeCellWidget(m_playRowIndex, 0);
 
-    delete m_musicSongsPlayWidget;
-    m_musicSongsPlayWidget = nullptr;
+        delete m_musicSongsPlayWidget;
+        m_musicSongsPlayWidget = nullptr;
 
-    m_playRowIndex = -1;
+        m_playRowIndex = -1;
+    }
     //Remove all the original item
     MusicAbstractSongsListTableWidget::clear();
     setColumnCount(6);
@@ -249,39 +214,16 @@ void MusicSongsListTableWidget::adjustPlayWidgetRow()
         return;
     }
 
-    const QString &name = !m_musicSongs->isEmpty() ? m_musicSongs->at(m_playRowIndex).getMusicName() : QString();
-
     setRowHeight(m_playRowIndex, ITEM_ROW_HEIGHT_M);
 
     removeCellWidget(m_playRowIndex, 0);
-    delete takeItem(m_playRowIndex, 0);
     clearSpans();
 
-    QHeaderView *headerview = horizontalHeader();
-    QTableWidgetItem *item = new QTableWidgetItem;
-    setItem(m_playRowIndex, 0, item);
-
-    item = new QTableWidgetItem(MusicUtils::Widget::elidedText(font(), name, Qt::ElideRight, headerview->sectionSize(1) - 10));
-#if TTK_QT_VERSION_CHECK(5,13,0)
-    item->setForeground(QColor(MusicUIObject::MQSSColor01));
-#else
-    item->setTextColor(QColor(MusicUIObject::MQSSColor01));
-#endif
-    item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-
-    setItem(m_playRowIndex, 1, item);
-    setItem(m_playRowIndex, 2, new QTableWidgetItem);
-    setItem(m_playRowIndex, 3, new QTableWidgetItem);
-    setItem(m_playRowIndex, 4, new QTableWidgetItem);
-
-    item = new QTableWidgetItem((*m_musicSongs)[m_playRowIndex].getMusicPlayTime());
-#if TTK_QT_VERSION_CHECK(5,13,0)
-    item->setForeground(QColor(MusicUIObject::MQSSColor01));
-#else
-    item->setTextColor(QColor(MusicUIObject::MQSSColor01));
-#endif
-    item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
-    setItem(m_playRowIndex, 5, item);
+    ///text items of the row are created again when it is painted
+    for(int i=0; i<columnCount(); ++i)
+    {
+        delete takeItem(m_playRowIndex, i);
+    }
 
     delete m_musicSongsPlayWidget;
     m_musicSongsPlayWidget = nullptr;
@@ -317,6 +259,19 @@ bool MusicSongsListTableWidget::createUploadFileModule()
 
 void MusicSongsListTableWidget::itemCellEntered(int row, int column)
 {
+    ///icon items are only created for the rows being hovered
+    if(row >= 0 && row != m_playRowIndex)
+    {
+        createRowItems(row);
+        for(int i=0; i<columnCount(); ++i)
+        {
+            if(!item(row, i))
+            {
+                setItem(row, i, new QTableWidgetItem);
+            }
+        }
+    }
+
     ///clear previous table item state
     QTableWidgetItem *it = item(m_previousColorRow, 0);
     if(it)
@@ -556,6 +511,7 @@ void MusicSongsListTableWidget::setChangSongName()
     m_renameLineEditDelegate = new MusicRenameLineEditDelegate(this);
     setItemDelegateForRow(currentRow(), m_renameLineEditDelegate);
     m_renameActived = true;
+    createRowItems(currentRow());
     m_renameItem = item(currentRow(), 1);
     m_renameItem->setText((*m_musicSongs)[m_renameItem->row()].getMusicName());
     openPersistentEditor(m_renameItem);
@@ -631,6 +587,7 @@ void MusicSongsListTableWidget::setItemRenameFinished(const QString &name)
     }
 
     (*m_musicSongs)[m_playRowIndex].setMusicName(name);
+    Q_EMIT musicListSongNameChanged(m_parentToolIndex, m_playRowIndex);
 }
 
 void MusicSongsListTableWidget::musicListSongSortBy(QAction *action)
@@ -694,6 +651,28 @@ void MusicSongsListTableWidget::mouseReleaseEvent(QMouseEvent *event)
     setSelectionMode(QAbstractItemView::ExtendedSelection);
 }
 
+void MusicSongsListTableWidget::paintEvent(QPaintEvent *event)
+{
+    ///only the rows inside the exposed area get their text items
+    const QRect &rect = event->rect();
+    const int first = rowAt(rect.top());
+    if(first != -1)
+    {
+        int last = rowAt(rect.bottom());
+        if(last == -1)
+        {
+            last = rowCount() - 1;
+        }
+
+        for(int i=first; i<=last; ++i)
+        {
+            createRowItems(i);
+        }
+    }
+
+    MusicAbstractSongsListTableWidget::paintEvent(event);
+}
+
 void MusicSongsListTableWidget::leaveEvent(QEvent *event)
 {
     MusicAbstractSongsListTableWidget::leaveEvent(event);
@@ -823,6 +802,7 @@ void MusicSongsListTableWidget::closeRenameItem()
     {
         QHeaderView *headerview = horizontalHeader();
         (*m_musicSongs)[m_renameItem->row()].setMusicName(m_renameItem->text());
+        Q_EMIT musicListSongNameChanged(m_parentToolIndex, m_renameItem->row());
         m_renameItem->setText(MusicUtils::Widget::elidedText(font(), m_renameItem->text(), Qt::ElideRight, headerview->sectionSize(1) - 10));
 
         m_renameActived = false;
@@ -834,6 +814,39 @@ void MusicSongsListTableWidget::closeRenameItem()
     }
 }
 
+void MusicSongsListTableWidget::createRowItems(int row)
+{
+    if(row == m_playRowIndex || row < 0 || row >= m_musicSongs->count() || item(row, 1))
+    {
+        return;
+    }
+
+    const MusicSong &song = m_musicSongs->at(row);
+    QHeaderView *headerview = horizontalHeader();
+
+    QTableWidgetItem *it = new QTableWidgetItem;
+    it->setText(MusicUtils::Widget::elidedText(font(), song.getMusicName(), Qt::ElideRight, headerview->sectionSize(1) - 10));
+#if TTK_QT_VERSION_CHECK(5,13,0)
+    it->setForeground(QColor(MusicUIObject::MQSSColor01));
+#else
+    it->setTextColor(QColor(MusicUIObject::MQSSColor01));
+#endif
+    it->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
+    setItem(row, 1, it);
+
+    if(!item(row, 5))
+    {
+        it = new QTableWidgetItem(song.getMusicPlayTime());
+#if TTK_QT_VERSION_CHECK(5,13,0)
+        it->setForeground(QColor(MusicUIObject::MQSSColor01));
+#else
+        it->setTextColor(QColor(MusicUIObject::MQSSColor01));
+#endif
+        it->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
+        setItem(row, 5, it);
+    }
+}
+
 void MusicSongsListTableWidget::startToDrag()
 {
     bool empty;
@@ -873,9 +886,9 @@ void MusicSongsListTableWidget::startToDrag()
                 continue; //skip the current play item index, because the play widget just has one item
             }
 
-            QHeaderView *headerview = horizontalHeader();
-            item(i, 1)->setText(MusicUtils::Widget::elidedText(font(), songs[i].getMusicName(), Qt::ElideRight, headerview->sectionSize(1) - 10));
-            item(i, 5)->setText(songs[i].getMusicPlayTime());
+            ///swapped rows are refreshed when painted
+            delete takeItem(i, 1);
+            delete takeItem(i, 5);
         }
 
         bool state;
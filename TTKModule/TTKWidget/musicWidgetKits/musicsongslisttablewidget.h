@@ -114,6 +114,10 @@ Q_SIGNALS:
      * Music list songs sort by type.
      */
     void musicListSongSortBy(int index);
+    /*!
+     * Music list song name changed by row.
+     */
+    void musicListSongNameChanged(int index, int row);
 
 public Q_SLOTS:
     /*!
@@ -180,6 +184,7 @@ protected:
     virtual void mousePressEvent(QMouseEvent *event) override;
     virtual void mouseMoveEvent(QMouseEvent *event) override;
     virtual void mouseReleaseEvent(QMouseEvent *event) override;
+    virtual void paintEvent(QPaintEvent *event) override;
     virtual void leaveEvent(QEvent *event) override;
     virtual void wheelEvent(QWheelEvent *event) override;
     virtual void contextMenuEvent(QContextMenuEvent *event) override;
@@ -187,6 +192,10 @@ protected:
      * Close rename item.
      */
     void closeRenameItem();
+    /*!
+     * Create text items of row when it is first shown.
+     */
+    void createRowItems(int row);
     /*!
      * Start to drag to play list.
      */
@@ -6,6 +6,7 @@
 #include "musicplayer.h"
 #include "musicformats.h"
 #include "musicplaylist.h"
+#include "musicsongprefetcher.h"
 #include "musicbackgroundmanager.h"
 #include "musicsettingmanager.h"
 #include "ttkversion.h"
@@ -23,6 +24,10 @@
 #include "musictinyuiobject.h"
 #include "musicdispatchmanager.h"
 #include "musictkplconfigmanager.h"
+#include "musicsonglibrarymanager.h"
+#include "musicplayliststoremanager.h"
+#include "musicstartupmanager.h"
+#include "musicdownloadcachemanager.h"
 
 #include <QMimeData>
 
@@ -51,6 +56,7 @@ MusicApplication::MusicApplication(QWidget *parent)
     //
     m_musicPlayer = new MusicPlayer(this);
     m_musicPlaylist = new MusicPlaylist(this);
+    m_songPrefetcher = new MusicSongPrefetcher(m_musicPlaylist, this);
     m_musicSongTreeWidget = new MusicSongsSummariziedWidget(this);
     m_ui->songsContainer->addWidget(m_musicSongTreeWidget);
 
@@ -59,6 +65,7 @@ MusicApplication::MusicApplication(QWidget *parent)
     m_rightAreaWidget->setupUi(m_ui);
     m_leftAreaWidget->setupUi(m_ui);
     m_topAreaWidget->musicBackgroundAnimationChanged(false);
+    G_STARTUP_PTR->mark("widget");
 
     connect(m_rightAreaWidget, SIGNAL(updateBackgroundTheme()), m_topAreaWidget, SLOT(musicBackgroundTransparentChanged()));
     connect(m_rightAreaWidget, SIGNAL(updateBackgroundThemeDownload()), m_topAreaWidget, SLOT(musicBackgroundThemeDownloadFinished()));
@@ -95,12 +102,13 @@ MusicApplication::MusicApplication(QWidget *parent)
 
     readSystemConfigFromFile();
 
-    QTimer::singleShot(MT_MS, m_rightAreaWidget, SLOT(musicLoadSongIndexWidget()));
+    G_STARTUP_PTR->append("songIndex", m_rightAreaWidget, "musicLoadSongIndexWidget");
 }
 
 MusicApplication::~MusicApplication()
 {
     delete m_musicPlayer;
+    delete m_songPrefetcher;
     delete m_musicPlaylist;
     delete m_musicSongTreeWidget;
     delete m_bottomAreaWidget;
@@ -170,6 +178,10 @@ void MusicApplication::musicLoadCurrentSongLrc()
     const QString &path = QFile::exists(prefix + filename + LRC_FILE) ? (prefix + filename + LRC_FILE) : (prefix + filename + KRC_FILE);
     m_rightAreaWidget->loadCurrentSongLrc(filename, path);
 
+    G_DOWNLOAD_CACHE_PTR->touch(m_musicPlaylist->currentMediaPath());
+    G_DOWNLOAD_CACHE_PTR->touch(path);
+    G_DOWNLOAD_CACHE_PTR->touch(ART_DIR_FULL + MusicUtils::String::artistName(filename) + SKN_FILE);
+
     //reset current song lrc index.
     QTimer::singleShot(MT_S2MS, this, SLOT(resetCurrentSongLrcIndex()));
 }
@@ -1090,13 +1102,21 @@ void MusicApplication::readSystemConfigFromFile()
     int value = DEFAULT_LOWER_LEVEL;
 
     //Path configuration song
+    G_LIBRARY_PTR->readLibrary();
     MusicSongItems songs;
-    MusicTKPLConfigManager listXml;
-    if(listXml.readConfig())
+    if(!G_PLAYLIST_STORE_PTR->readPlaylist(songs))
     {
-        listXml.readPlaylistData(songs);
+        ///migrate from the old tkpl playlist
+        MusicTKPLConfigManager listXml;
+        if(listXml.readConfig())
+        {
+            listXml.readPlaylistData(songs);
+        }
     }
     const bool success = m_musicSongTreeWidget->addMusicLists(songs);
+    G_PLAYLIST_STORE_PTR->resetPlaylist(m_musicSongTreeWidget->getMusicLists());
+    G_LIBRARY_PTR->revalidate();
+    G_STARTUP_PTR->mark("playlist");
     //
     MusicConfigManager xml;
     if(!xml.readConfig())
@@ -1104,7 +1124,8 @@ void MusicApplication::readSystemConfigFromFile()
         return;
     }
     xml.readSysConfigData();
-    m_applicationObject->loadNetWorkSetting();
+    ///source update and counter requests are sent after the window is shown
+    G_STARTUP_PTR->append("network", m_applicationObject, "loadNetWorkSetting");
 
     //
     switch(G_SETTING_PTR->value(MusicSettingManager::PlayMode).toInt())
@@ -1133,23 +1154,14 @@ void MusicApplication::readSystemConfigFromFile()
 
     //Configure playback mode
     m_ui->musicEnhancedButton->setEnhancedMusicConfig(G_SETTING_PTR->value(MusicSettingManager::EnhancedMusic).toInt());
-    m_applicationObject->musicEffectChanged();
+    G_STARTUP_PTR->append("effect", m_applicationObject, "musicEffectChanged");
     if(G_SETTING_PTR->value(MusicSettingManager::EqualizerEnable).toInt() == 1)
     {
         m_musicPlayer->setEqInformation();
     }
 
     //music hotkey
-    if(G_SETTING_PTR->value(MusicSettingManager::HotkeyEnable).toBool())
-    {
-        QStringList hotkeys = G_SETTING_PTR->value(MusicSettingManager::HotkeyString).toString().split(TTK_STR_SPLITER);
-        if(hotkeys.count() != G_HOTKEY_PTR->count())
-        {
-            hotkeys = G_HOTKEY_PTR->getDefaultKeys();
-        }
-        G_HOTKEY_PTR->setHotKeys(hotkeys);
-        G_HOTKEY_PTR->enabledAll(true);
-    }
+    G_STARTUP_PTR->append("hotkey", m_applicationObject, "loadHotKeySetting");
 
     //musicSetting
     G_SETTING_PTR->setValue(MusicSettingManager::OtherSideByIn, false);
@@ -1225,12 +1237,13 @@ void MusicApplication::readSystemConfigFromFile()
     //Update check on
     if(G_SETTING_PTR->value(MusicSettingManager::OtherCheckUpdate).toBool())
     {
-        m_applicationObject->soureUpdateCheck();
+        G_STARTUP_PTR->append("update", m_applicationObject, "soureUpdateCheck");
     }
 
     m_rightAreaWidget->applySettingParameter();
     m_bottomAreaWidget->applySettingParameter();
     m_applicationObject->applySettingParameter();
+    G_STARTUP_PTR->mark("setting");
 }
 
 void MusicApplication::writeSystemConfigToFile()
@@ -1262,6 +1275,7 @@ void MusicApplication::writeSystemConfigToFile()
     G_SETTING_PTR->setValue(MusicSettingManager::ShowDesktopLrc, m_rightAreaWidget->getDestopLrcVisible());
     xml.writeSysConfigData();
 
-    MusicTKPLConfigManager listXml;
-    listXml.writePlaylistData(m_musicSongTreeWidget->getMusicLists());
+    G_PLAYLIST_STORE_PTR->writePlaylist(m_musicSongTreeWidget->getMusicLists());
+    G_LIBRARY_PTR->writeLibrary();
+    G_DOWNLOAD_CACHE_PTR->writeCache();
 }
@@ -23,6 +23,7 @@
 
 class MusicPlayer;
 class MusicPlaylist;
+class MusicSongPrefetcher;
 class MusicSongsSummariziedWidget;
 class MusicBottomAreaWidget;
 class MusicTopAreaWidget;
@@ -331,6 +332,7 @@ private:
 
     MusicPlayer* m_musicPlayer;
     MusicPlaylist* m_musicPlaylist;
+    MusicSongPrefetcher *m_songPrefetcher;
     MusicSongsSummariziedWidget *m_musicSongTreeWidget;
     MusicBottomAreaWidget *m_bottomAreaWidget;
     MusicTopAreaWidget *m_topAreaWidget;
@@ -7,6 +7,7 @@
 #include "musictoastlabel.h"
 #include "musicequalizerdialog.h"
 #include "musicsettingmanager.h"
+#include "musichotkeymanager.h"
 #include "musicplatformmanager.h"
 #include "musicsourceupdatewidget.h"
 #include "musicsoundeffectswidget.h"
@@ -17,6 +18,7 @@
 #include "musicgiflabelwidget.h"
 #include "musicurlutils.h"
 #include "musicfileutils.h"
+#include "musicdownloadcachemanager.h"
 #include "musicalgorithmutils.h"
 #include "musicsourceupdaterequest.h"
 #include "musicdownloadcounterpvrequest.h"
@@ -107,6 +109,22 @@ void MusicApplicationModule::loadNetWorkSetting()
     m_counterPVThread->startToDownload();
 }
 
+void MusicApplicationModule::loadHotKeySetting()
+{
+    if(!G_SETTING_PTR->value(MusicSettingManager::HotkeyEnable).toBool())
+    {
+        return;
+    }
+
+    QStringList hotkeys = G_SETTING_PTR->value(MusicSettingManager::HotkeyString).toString().split(TTK_STR_SPLITER);
+    if(hotkeys.count() != G_HOTKEY_PTR->count())
+    {
+        hotkeys = G_HOTKEY_PTR->getDefaultKeys();
+    }
+    G_HOTKEY_PTR->setHotKeys(hotkeys);
+    G_HOTKEY_PTR->enabledAll(true);
+}
+
 void MusicApplicationModule::applySettingParameter()
 {
 #ifdef Q_OS_WIN
@@ -451,5 +469,6 @@ void MusicApplicationModule::cleanUp()
 {
     ///remove daily pic theme
     MusicUtils::File::removeRecursively(TTK_STRCAT(CACHE_DIR_FULL, MUSIC_DAILY_DIR));
+    G_DOWNLOAD_CACHE_PTR->removeByDir(TTK_STRCAT(CACHE_DIR_FULL, MUSIC_DAILY_DIR));
     ///other remove in ttkdumper
 }
@@ -57,10 +57,6 @@ public:
      * Is lasted version.
      */
     bool isLastedVersion() const;
-    /*!
-     * load network settings parameters.
-     */
-    void loadNetWorkSetting();
     /*!
      * Apply settings parameters.
      */
@@ -69,10 +65,6 @@ public:
      * Window close animation.
      */
     void windowCloseAnimation();
-    /*!
-     * Soure update check.
-     */
-    void soureUpdateCheck();
 
     /*!
      * Side animation by on.
@@ -150,6 +142,18 @@ public Q_SLOTS:
      * Sound effect changed.
      */
     void musicEffectChanged();
+    /*!
+     * load network settings parameters.
+     */
+    void loadNetWorkSetting();
+    /*!
+     * load and register hotkey settings.
+     */
+    void loadHotKeySetting();
+    /*!
+     * Soure update check.
+     */
+    void soureUpdateCheck();
 
 protected:
     /*!
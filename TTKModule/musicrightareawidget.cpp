@@ -155,7 +155,9 @@ void MusicRightAreaWidget::updateCurrentLrc(qint64 current, qint64 total, bool p
     QString currentLrc, laterLrc;
     qint64 intervalTime;
     if(m_lrcAnalysis->findText(current, total, currentLrc, laterLrc, intervalTime))
-    {   //If this is a new line of the lyrics, then restart lyrics display mask
+    {   //Play position in current line, used to keep lyrics mask in sync with sound
+        const qint64 position = current - m_lrcAnalysis->getTime(m_lrcAnalysis->findIndex(current));
+        //If this is a new line of the lyrics, then restart lyrics display mask
         if(currentLrc != m_musicLrcForInterior->text())
         {
             if(!playStatus)
@@ -174,6 +176,15 @@ void MusicRightAreaWidget::updateCurrentLrc(qint64 current, qint64 total, bool p
                 m_musicLrcForWallpaper->updateCurrentLrc(intervalTime);
             }
         }
+        else
+        {
+            m_musicLrcForInterior->syncLrcMask(position);
+            if(m_musicLrcForWallpaper)
+            {
+                m_musicLrcForWallpaper->syncLrcMask(position);
+            }
+        }
+        m_musicLrcForDesktop->syncLrcMask(position);
     }
 }
 
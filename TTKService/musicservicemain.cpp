@@ -1,5 +1,7 @@
 #include "musicapplication.h"
 #include "musicruntimemanager.h"
+#include "musicstartupmanager.h"
+#include "musicdownloadcachemanager.h"
 #include "musicconfigobject.h"
 #include "musicplatformmanager.h"
 #include "ttkdumper.h"
@@ -31,6 +33,7 @@ int main(int argc, char *argv[])
     loadAppScaledFactor(argc, argv);
     //
     QApplication a(argc, argv);
+    G_STARTUP_PTR->start();
 #if !defined TTK_DEBUG && !defined Q_OS_UNIX
     if(argc <= 1 || QString(argv[1]) != APP_NAME)
     {
@@ -44,19 +47,25 @@ int main(int argc, char *argv[])
 
     MusicConfigObject object;
     object.checkValid();
+    G_STARTUP_PTR->mark("config");
 
     TTKDumper dumper;
     dumper.run();
+    G_STARTUP_PTR->mark("dumper");
 
     MusicRunTimeManager manager;
     manager.run();
+    G_STARTUP_PTR->mark("runtime");
 
     QTranslator translator;
     translator.load(manager.translator());
     a.installTranslator(&translator);
+    G_STARTUP_PTR->mark("translator");
 
     MusicApplication w;
+    G_STARTUP_PTR->mark("application");
     w.show();
+    G_STARTUP_PTR->mark("show");
 
     if(argc == 4)
     {
@@ -74,5 +83,9 @@ int main(int argc, char *argv[])
         }
     }
 
+    ///everything not needed for the first frame runs after the window is shown
+    G_STARTUP_PTR->append("cache", G_DOWNLOAD_CACHE_PTR, "checkCacheSize");
+    G_STARTUP_PTR->run();
+
     return a.exec();
 }
@@ -2,112 +2,170 @@
 #include "random.h"
 
 #include <qmath.h>
+#include <QThread>
 #include <QPainter>
+#include <QSemaphore>
+#include <QThreadPool>
+
+#define RENDER_ROWS_MIN_PIXELS  (256 * 256)
+#define GAUSS_FIXED_SHIFT       16
 
 namespace QImageWrapper {
+/*! @brief The class of the render rows runnable.
+ * @author Greedysky <greedysky@163.com>
+ */
+class RenderRowsRunnable : public QRunnable
+{
+public:
+    RenderRowsRunnable(const std::function<void(int, int)> &kernel, int begin, int end, QSemaphore *done)
+        : m_kernel(kernel), m_begin(begin), m_end(end), m_done(done)
+    {
+        setAutoDelete(true);
+    }
+
+    virtual void run() override
+    {
+        m_kernel(m_begin, m_end);
+        m_done->release();
+    }
+
+private:
+    std::function<void(int, int)> m_kernel;
+    int m_begin, m_end;
+    QSemaphore *m_done;
+};
+
+static QThreadPool *renderPool()
+{
+    static QThreadPool pool;
+    pool.setMaxThreadCount(QThread::idealThreadCount());
+    return &pool;
+}
+
+void renderRows(int width, int height, const std::function<void(int, int)> &kernel)
+{
+    const int count = qMin(QThread::idealThreadCount(), height);
+    if(count <= 1 || width * height < RENDER_ROWS_MIN_PIXELS)
+    {
+        kernel(0, height);
+        return;
+    }
+
+    // the pool is shared by all callers, so wait for own ranges only instead of the whole pool
+    QSemaphore done;
+    int started = 0;
+    const int step = (height + count - 1) / count;
+    for(int begin = step; begin < height; begin += step)
+    {
+        renderPool()->start(new RenderRowsRunnable(kernel, begin, qMin(begin + step, height), &done));
+        ++started;
+    }
+
+    // the calling thread renders the first range itself
+    kernel(0, qMin(step, height));
+    done.acquire(started);
+}
+
+
 void GaussBlur::render(int* pix, int width, int height, int radius)
 {
+    if(!pix || width <= 0 || height <= 0 || radius <= 0)
+    {
+        return;
+    }
+
     const float sigma =  1.0 * radius / 2.57;
-    const float deno  =  1.0 / (sigma * sqrt(2.0 * M_PI));
     const float nume  = -1.0 / (2.0 * sigma * sigma);
+    const int size = radius + radius + 1;
 
-    float* gaussMatrix = (float*)malloc(sizeof(float)* (radius + radius + 1));
+    QVector<float> gauss(size);
     float gaussSum = 0.0;
     for(int i = 0, x = -radius; x <= radius; ++x, ++i)
     {
-        float g = deno * exp(1.0 * nume * x * x);
-
-        gaussMatrix[i] = g;
-        gaussSum += g;
+        gauss[i] = exp(1.0 * nume * x * x);
+        gaussSum += gauss[i];
     }
 
-    const int len = radius + radius + 1;
-    for(int i = 0; i < len; ++i)
+    // fixed point weights, the sum is exactly 1 << GAUSS_FIXED_SHIFT
+    QVector<int> weights(size);
+    int weightSum = 0;
+    for(int i = 0; i < size; ++i)
     {
-        gaussMatrix[i] /= gaussSum;
+        weights[i] = qRound(gauss[i] / gaussSum * (1 << GAUSS_FIXED_SHIFT));
+        weightSum += weights[i];
     }
+    weights[radius] += (1 << GAUSS_FIXED_SHIFT) - weightSum;
 
-    int* rowData  = (int*)malloc(width * sizeof(int));
-    int* listData = (int*)malloc(height * sizeof(int));
+    const int *weight = weights.constData();
+    const int half = 1 << (GAUSS_FIXED_SHIFT - 1);
+    QVector<uint> buffer(width * height);
+    uint *temp = buffer.data();
+    uint *data = (uint*)pix;
 
-    for(int y = 0; y < height; ++y)
+    // horizontal pass, edges are clamped by padding the row
+    renderRows(width, height, [=](int begin, int end)
     {
-        memcpy(rowData, pix + y * width, sizeof(int) *width);
-
-        for(int x = 0; x < width; ++x)
+        QVector<uint> padding(width + radius + radius);
+        uint *line = padding.data();
+        for(int y = begin; y < end; ++y)
         {
-            float r = 0, g = 0, b = 0;
-            gaussSum = 0;
-
-            for(int i = -radius; i <= radius; ++i)
+            const uint *row = data + y * width;
+            for(int i = 0; i < radius; ++i)
             {
-                int k = x + i;
+                line[i] = row[0];
+                line[radius + width + i] = row[width - 1];
+            }
+            memcpy(line + radius, row, sizeof(uint) * width);
 
-                if(0 <= k && k <= width)
+            uint *out = temp + y * width;
+            for(int x = 0; x < width; ++x)
+            {
+                const uint *p = line + x;
+                int r = half, g = half, b = half;
+                for(int i = 0; i < size; ++i)
                 {
-                    int color = rowData[k];
-                    int cr = (color & 0x00ff0000) >> 16;
-                    int cg = (color & 0x0000ff00) >> 8;
-                    int cb = (color & 0x000000ff);
-
-                    r += cr * gaussMatrix[i + radius];
-                    g += cg * gaussMatrix[i + radius];
-                    b += cb * gaussMatrix[i + radius];
-
-                    gaussSum += gaussMatrix[i + radius];
+                    const uint color = p[i];
+                    r += ((color >> 16) & 0xff) * weight[i];
+                    g += ((color >> 8) & 0xff) * weight[i];
+                    b += (color & 0xff) * weight[i];
                 }
+                out[x] = (r >> GAUSS_FIXED_SHIFT) << 16 | (g >> GAUSS_FIXED_SHIFT) << 8 | (b >> GAUSS_FIXED_SHIFT) | 0xff000000;
             }
-
-            int cr = (int)(r / gaussSum);
-            int cg = (int)(g / gaussSum);
-            int cb = (int)(b / gaussSum);
-
-            pix[y * width + x] = cr << 16 | cg << 8 | cb | 0xff000000;
         }
-    }
+    });
 
-    for(int x = 0; x < width; ++x)
+    // vertical pass, walks whole rows to keep memory access sequential
+    renderRows(width, height, [=](int begin, int end)
     {
-        for(int y = 0; y < height; ++y)
-        {
-            listData[y] = pix[y * width + x];
-        }
-
-        for(int y = 0; y < height; ++y)
+        QVector<int> accumulate(width * 3);
+        int *acc = accumulate.data();
+        for(int y = begin; y < end; ++y)
         {
-            float r = 0, g = 0, b = 0;
-            gaussSum = 0;
-
-            for(int j = -radius; j <= radius; ++j)
+            for(int x = 0; x < width * 3; ++x)
             {
-                int k = y + j;
+                acc[x] = half;
+            }
 
-                if(0 <= k && k <= height)
+            for(int i = 0; i < size; ++i)
+            {
+                const uint *row = temp + qBound(0, y + i - radius, height - 1) * width;
+                const int w = weight[i];
+                for(int x = 0; x < width; ++x)
                 {
-                    int color = listData[k];
-                    int cr = (color & 0x00ff0000) >> 16;
-                    int cg = (color & 0x0000ff00) >> 8;
-                    int cb = (color & 0x000000ff);
-
-                    r += cr * gaussMatrix[j + radius];
-                    g += cg * gaussMatrix[j + radius];
-                    b += cb * gaussMatrix[j + radius];
-
-                    gaussSum += gaussMatrix[j + radius];
+                    const uint color = row[x];
+                    acc[x * 3] += ((color >> 16) & 0xff) * w;
+                    acc[x * 3 + 1] += ((color >> 8) & 0xff) * w;
+                    acc[x * 3 + 2] += (color & 0xff) * w;
                 }
             }
 
-            int cr = (int)(r / gaussSum);
-            int cg = (int)(g / gaussSum);
-            int cb = (int)(b / gaussSum);
-
-            pix[y * width + x] = cr << 16 | cg << 8 | cb | 0xff000000;
+            uint *out = data + y * width;
+            for(int x = 0; x < width; ++x)
+            {
+                out[x] = (acc[x * 3] >> GAUSS_FIXED_SHIFT) << 16 | (acc[x * 3 + 1] >> GAUSS_FIXED_SHIFT) << 8 | (acc[x * 3 + 2] >> GAUSS_FIXED_SHIFT) | 0xff000000;
+            }
         }
-    }
-
-    free(gaussMatrix);
-    free(rowData);
-    free(listData);
+    });
 }
 
 
@@ -20,12 +20,18 @@
  ================================================= */
 
 #include <QImage>
+#include <functional>
 #include "ttkprivate.h"
 
 /*! @brief The class of the image wrapper.
  * @author Greedysky <greedysky@163.com>
  */
 namespace QImageWrapper {
+/*!
+ * Run kernel over row ranges [begin, end), split across threads for large image.
+ */
+TTK_MODULE_EXPORT void renderRows(int width, int height, const std::function<void(int, int)> &kernel);
+
 /*! @brief The class of the gauss blur.
  * @author Greedysky <greedysky@163.com>
  */
@@ -6,8 +6,24 @@
 
 #include <QFile>
 #include <QRegExp>
+#include <QFileInfo>
 #include <QNetworkInterface>
 
+#define SERVER_PORT         11111
+#define CHUNK_SIZE          (64 * 1024)
+#define CHUNK_WATER_MARK    (4 * CHUNK_SIZE)
+
+/*! @brief The class of the dlna file stream.
+ * @author Greedysky <greedysky@163.com>
+ */
+class QDlnaFileStream
+{
+public:
+    QFile m_file;
+    qint64 m_remaining;
+
+};
+
 /*! @brief The class of the dlna file server private.
  * @author Greedysky <greedysky@163.com>
  */
@@ -19,6 +35,7 @@ public:
 
     QString m_prefix;
     QHttpServer *m_server;
+    QHash<QHttpResponse*, QDlnaFileStream*> m_streams;
 
 };
 
@@ -29,10 +46,42 @@ QDlnaFileServerPrivate::QDlnaFileServerPrivate()
 
 QDlnaFileServerPrivate::~QDlnaFileServerPrivate()
 {
+    qDeleteAll(m_streams);
     m_server->close();
     delete m_server;
 }
 
+/*!
+ * Parse single byte range header, return false if it is not satisfiable.
+ */
+static bool parseRange(const QString &value, qint64 size, qint64 &start, qint64 &end)
+{
+    QRegExp regx("^bytes=(\\d*)-(\\d*)$");
+    if(regx.indexIn(value.trimmed()) == -1 || (regx.cap(1).isEmpty() && regx.cap(2).isEmpty()))
+    {
+        return false;
+    }
+
+    if(regx.cap(1).isEmpty())
+    {
+        ///suffix range, the last N bytes
+        const qint64 length = regx.cap(2).toLongLong();
+        if(length <= 0)
+        {
+            return false;
+        }
+
+        start = qMax<qint64>(0, size - length);
+        end = size - 1;
+    }
+    else
+    {
+        start = regx.cap(1).toLongLong();
+        end = regx.cap(2).isEmpty() ? size - 1 : qMin(regx.cap(2).toLongLong(), size - 1);
+    }
+    return start <= end && start < size;
+}
+
 
 
 QDlnaFileServer::QDlnaFileServer(QObject *parent)
@@ -46,7 +95,7 @@ QDlnaFileServer::QDlnaFileServer(QObject *parent)
 void QDlnaFileServer::start()
 {    
     TTK_D(QDlnaFileServer);
-    d->m_server->listen(QHostAddress::Any, 11111);
+    d->m_server->listen(QHostAddress::Any, SERVER_PORT);
 }
 
 void QDlnaFileServer::setPrefixPath(const QString &path)
@@ -62,37 +111,153 @@ QString QDlnaFileServer::getLocalAddress(const QString &prefix) const
     {
       if(address.toString().contains(value))
       {
-          return QString("http://%1:11111/").arg(address.toString());
+          return QString("http://%1:%2/music/").arg(address.toString()).arg(SERVER_PORT);
       }
     }
-    return "http://0.0.0.0:11111/";
+    return QString("http://0.0.0.0:%1/music/").arg(SERVER_PORT);
+}
+
+QString QDlnaFileServer::mimeType(const QString &suffix)
+{
+    static QHash<QString, QString> types;
+    if(types.isEmpty())
+    {
+        types.insert("mp3", "audio/mpeg");
+        types.insert("mp2", "audio/mpeg");
+        types.insert("mpc", "audio/x-musepack");
+        types.insert("flac", "audio/flac");
+        types.insert("ape", "audio/x-ape");
+        types.insert("wv", "audio/x-wavpack");
+        types.insert("wav", "audio/wav");
+        types.insert("aif", "audio/x-aiff");
+        types.insert("aiff", "audio/x-aiff");
+        types.insert("aac", "audio/aac");
+        types.insert("m4a", "audio/mp4");
+        types.insert("m4b", "audio/mp4");
+        types.insert("alac", "audio/mp4");
+        types.insert("mp4", "audio/mp4");
+        types.insert("ogg", "audio/ogg");
+        types.insert("oga", "audio/ogg");
+        types.insert("opus", "audio/ogg");
+        types.insert("spx", "audio/ogg");
+        types.insert("wma", "audio/x-ms-wma");
+        types.insert("amr", "audio/amr");
+        types.insert("ac3", "audio/ac3");
+        types.insert("dts", "audio/vnd.dts");
+        types.insert("tta", "audio/x-tta");
+        types.insert("mid", "audio/midi");
+        types.insert("midi", "audio/midi");
+    }
+    return types.value(suffix.toLower(), "application/octet-stream");
 }
 
 void QDlnaFileServer::handleRequest(QHttpRequest *request, QHttpResponse *response)
 {
     TTK_D(QDlnaFileServer);
     QRegExp regx("^/music/(.*)$");
-    if(regx.indexIn(request->path()) != -1)
+    if(regx.indexIn(request->path()) == -1 || regx.cap(1).contains(".."))
     {
-        response->setHeader("Content-Type", "audio/mp3");
+        response->writeHead(QHttpResponse::STATUS_FORBIDDEN);
+        response->end("You aren't allowed here");
+        return;
+    }
 
-        const QString &name = regx.cap(1);
-        QFile file(d->m_prefix + "/" + name);
-        if(file.open(QFile::ReadOnly))
+    if(request->method() != QHttpRequest::HTTP_GET && request->method() != QHttpRequest::HTTP_HEAD)
+    {
+        response->setHeader("Allow", "GET, HEAD");
+        response->writeHead(QHttpResponse::STATUS_METHOD_NOT_ALLOWED);
+        response->end();
+        return;
+    }
+
+    QDlnaFileStream *stream = new QDlnaFileStream;
+    stream->m_file.setFileName(d->m_prefix + "/" + regx.cap(1));
+    if(!stream->m_file.open(QFile::ReadOnly))
+    {
+        delete stream;
+        response->writeHead(QHttpResponse::STATUS_NOT_FOUND);
+        response->end("Resource not found");
+        return;
+    }
+
+    const qint64 size = stream->m_file.size();
+    response->setHeader("Accept-Ranges", "bytes");
+    response->setHeader("Content-Type", mimeType(QFileInfo(stream->m_file.fileName()).suffix()));
+    response->setHeader("transferMode.dlna.org", "Streaming");
+
+    qint64 start = 0, end = size - 1;
+    const QString &range = request->header("range");
+    int status = QHttpResponse::STATUS_OK;
+    if(!range.isEmpty())
+    {
+        if(!parseRange(range, size, start, end))
         {
-            response->writeHead(200);
-            response->end(file.readAll());
-            file.close();
+            delete stream;
+            response->setHeader("Content-Range", QString("bytes */%1").arg(size));
+            response->writeHead(QHttpResponse::STATUS_REQUESTED_RANGE_NOT_SATISFIABLE);
+            response->end();
+            return;
         }
-        else
+
+        status = QHttpResponse::STATUS_PARTIAL_CONTENT;
+        response->setHeader("Content-Range", QString("bytes %1-%2/%3").arg(start).arg(end).arg(size));
+    }
+
+    stream->m_remaining = end - start + 1;
+    response->setHeader("Content-Length", QString::number(stream->m_remaining));
+    response->writeHead(status);
+
+    if(request->method() == QHttpRequest::HTTP_HEAD || stream->m_remaining <= 0 || !stream->m_file.seek(start))
+    {
+        delete stream;
+        response->end();
+        return;
+    }
+
+    ///only a few chunks are queued on the socket, the rest is written when the client drains it
+    d->m_streams.insert(response, stream);
+    connect(response, SIGNAL(allBytesWritten()), SLOT(writeChunk()));
+    connect(response, SIGNAL(done()), SLOT(responseDone()));
+    writeChunk(response, stream);
+}
+
+void QDlnaFileServer::writeChunk()
+{
+    TTK_D(QDlnaFileServer);
+    QHttpResponse *response = TTKObject_cast(QHttpResponse*, QObject::sender());
+    QDlnaFileStream *stream = d->m_streams.value(response);
+    if(stream)
+    {
+        writeChunk(response, stream);
+    }
+}
+
+void QDlnaFileServer::responseDone()
+{
+    TTK_D(QDlnaFileServer);
+    QHttpResponse *response = TTKObject_cast(QHttpResponse*, QObject::sender());
+    delete d->m_streams.take(response);
+}
+
+void QDlnaFileServer::writeChunk(QHttpResponse *response, QDlnaFileStream *stream)
+{
+    bool failed = false;
+    while(stream->m_remaining > 0 && response->bytesToWrite() < CHUNK_WATER_MARK)
+    {
+        const QByteArray &data = stream->m_file.read(qMin<qint64>(CHUNK_SIZE, stream->m_remaining));
+        if(data.isEmpty())
         {
-            response->writeHead(404);
-            response->end("Resource not found");
+            failed = true;
+            break;
         }
+
+        stream->m_remaining -= data.size();
+        response->write(data);
     }
-    else
+
+    if(failed || stream->m_remaining <= 0)
     {
-        response->writeHead(403);
-        response->end("You aren't allowed here");
+        ///stream is released in responseDone
+        response->end();
     }
 }
@@ -24,6 +24,7 @@
 
 class QHttpRequest;
 class QHttpResponse;
+class QDlnaFileStream;
 class QDlnaFileServerPrivate;
 
 /*! @brief The class of the dlna file server.
@@ -40,8 +41,18 @@ public:
     void setPrefixPath(const QString &path);
     QString getLocalAddress(const QString &prefix) const;
 
+    /*!
+     * Get mime type by file suffix.
+     */
+    static QString mimeType(const QString &suffix);
+
 private Q_SLOTS:
     void handleRequest(QHttpRequest *request, QHttpResponse *response);
+    void writeChunk();
+    void responseDone();
+
+private:
+    void writeChunk(QHttpResponse *response, QDlnaFileStream *stream);
 
 private:
     TTK_DECLARE_PRIVATE(QDlnaFileServer)
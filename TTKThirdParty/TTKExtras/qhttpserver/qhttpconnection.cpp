@@ -170,6 +170,12 @@ void QHttpConnection::write(const QByteArray &data)
     d->write(data);
 }
 
+qint64 QHttpConnection::bytesToWrite() const
+{
+    TTK_D(QHttpConnection);
+    return d->m_transmitLen - d->m_transmitPos;
+}
+
 void QHttpConnection::flush()
 {
     TTK_D(QHttpConnection);
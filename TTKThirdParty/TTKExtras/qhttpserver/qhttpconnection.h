@@ -33,6 +33,7 @@ public:
     explicit QHttpConnection(QTcpSocket *socket, QObject *parent = nullptr);
 
     void write(const QByteArray &data);
+    qint64 bytesToWrite() const;
     void flush();
     void waitForBytesWritten();
 
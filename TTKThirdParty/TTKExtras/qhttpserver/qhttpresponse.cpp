@@ -234,6 +234,12 @@ void QHttpResponse::flush()
     d->m_connection->flush();
 }
 
+qint64 QHttpResponse::bytesToWrite() const
+{
+    TTK_D(QHttpResponse);
+    return d->m_connection->bytesToWrite();
+}
+
 void QHttpResponse::waitForBytesWritten()
 {
     TTK_D(QHttpResponse);
@@ -105,6 +105,10 @@ public Q_SLOTS:
     /** @note writeHead() must be called before this function. */
     void flush();
 
+    /// Returns the number of bytes written but not yet transmitted to the client.
+    /** Use it together with allBytesWritten() to throttle large bodies. */
+    qint64 bytesToWrite() const;
+
     /// Waiting for bytes to be written. See QAbstractSocket::waitForBytesWritten in the Qt documentation
     /** @note writeHead() must be called before this function. */
     void waitForBytesWritten();
@@ -28,9 +28,83 @@
 #include <QtCore/QStringList>
 #include <QtCore/QTextStream>
 #include <QtCore/QDebug>
+#if TTK_QT_VERSION_CHECK(5,0,0)
+#  include <QtCore/QJsonArray>
+#  include <QtCore/QJsonObject>
+#  include <QtCore/QJsonDocument>
+#endif
 
 using namespace QJson;
 
+#if TTK_QT_VERSION_CHECK(5,0,0)
+namespace {
+  // Same value types as the bison parser: integers become qulonglong or
+  // qlonglong, other numbers double.
+  QVariant fromJsonValue(const QJsonValue &value);
+
+  QVariant fromJsonObject(const QJsonObject &object) {
+    QVariantMap map;
+    for (QJsonObject::const_iterator it = object.constBegin(); it != object.constEnd(); ++it)
+      map.insert(it.key(), fromJsonValue(it.value()));
+    return map;
+  }
+
+  QVariant fromJsonArray(const QJsonArray &array) {
+    QVariantList list;
+    list.reserve(array.size());
+    for (QJsonArray::const_iterator it = array.constBegin(); it != array.constEnd(); ++it)
+      list.append(fromJsonValue(*it));
+    return list;
+  }
+
+  QVariant fromJsonValue(const QJsonValue &value) {
+    switch (value.type()) {
+      case QJsonValue::Object:
+        return fromJsonObject(value.toObject());
+      case QJsonValue::Array:
+        return fromJsonArray(value.toArray());
+      case QJsonValue::String:
+        return value.toString();
+      case QJsonValue::Bool:
+        return value.toBool();
+      case QJsonValue::Double: {
+        const double number = value.toDouble();
+        const double limit = 9007199254740992.0; // 2^53, exact integer range of double
+        if (number > -limit && number < limit && number == qint64(number))
+          return number < 0 ? QVariant(qlonglong(number)) : QVariant(qulonglong(number));
+        return number;
+      }
+      default:
+        return QVariant();
+    }
+  }
+
+  // QJsonDocument stores every number as double, so integers with 16 or
+  // more digits (ids above 2^53) would lose precision. Such documents are
+  // left to the bison parser which keeps them exact.
+  bool hasLongNumber(const QByteArray &json) {
+    bool inString = false;
+    int digits = 0;
+    for (int i = 0; i < json.size(); ++i) {
+      const char c = json.at(i);
+      if (inString) {
+        if (c == '\\')
+          ++i;
+        else if (c == '"')
+          inString = false;
+      } else if (c >= '0' && c <= '9') {
+        if (++digits >= 16)
+          return true;
+      } else {
+        digits = 0;
+        inString = (c == '"');
+      }
+    }
+    return false;
+  }
+}
+#endif
+
 ParserPrivate::ParserPrivate() :
   m_scanner(0),
   m_specialNumbersAllowed(false)
@@ -112,6 +186,23 @@ QVariant Parser::parse (QIODevice* io, bool* ok)
 }
 
 QVariant Parser::parse(const QByteArray &jsonString, bool* ok) {
+#if TTK_QT_VERSION_CHECK(5,0,0)
+  // Qt json parser is much faster, the bison parser is kept for special
+  // numbers, long integers and for reporting errors
+  TTK_D(Parser);
+  if (!d->m_specialNumbersAllowed && !hasLongNumber(jsonString)) {
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(jsonString, &error);
+    if (error.error == QJsonParseError::NoError) {
+      d->reset();
+      d->m_result = document.isArray() ? fromJsonArray(document.array()) : fromJsonObject(document.object());
+      if (ok != 0)
+        *ok = true;
+      return d->m_result;
+    }
+  }
+#endif
+
   QBuffer buffer;
   buffer.open(QBuffer::ReadWrite | QBuffer::Text);
   buffer.write(jsonString);